@@ -0,0 +1,100 @@
+#include "RV_BlurHash.h"
+
+namespace RV_BlurHash
+{
+	static const TCHAR* Base83Chars = TEXT("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~");
+
+	static bool DecodeBase83(const FString& Str, int32 Start, int32 Length, int32& OutValue)
+	{
+		OutValue = 0;
+		for (int32 i = Start; i < Start + Length; ++i)
+		{
+			const TCHAR* Found = FCString::Strchr(Base83Chars, Str[i]);
+			if (!Found) return false;
+			OutValue = OutValue * 83 + static_cast<int32>(Found - Base83Chars);
+		}
+		return true;
+	}
+
+	static float SrgbToLinear(int32 Value)
+	{
+		const float V = Value / 255.f;
+		return V <= 0.04045f ? V / 12.92f : FMath::Pow((V + 0.055f) / 1.055f, 2.4f);
+	}
+
+	static uint8 LinearToSrgb(float Value)
+	{
+		const float V = FMath::Clamp(Value, 0.f, 1.f);
+		const float Srgb = V <= 0.0031308f ? V * 12.92f : 1.055f * FMath::Pow(V, 1.f / 2.4f) - 0.055f;
+		return static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Srgb * 255.f), 0, 255));
+	}
+
+	static float SignPow(float Value, float Exp)
+	{
+		return FMath::Sign(Value) * FMath::Pow(FMath::Abs(Value), Exp);
+	}
+
+	bool Decode(const FString& BlurHash, int32 Width, int32 Height, TArray<FColor>& OutPixels)
+	{
+		if (BlurHash.Len() < 6 || Width <= 0 || Height <= 0) return false;
+
+		int32 SizeFlag = 0;
+		if (!DecodeBase83(BlurHash, 0, 1, SizeFlag)) return false;
+		const int32 NumX = SizeFlag % 9 + 1;
+		const int32 NumY = SizeFlag / 9 + 1;
+		if (BlurHash.Len() != 4 + 2 * NumX * NumY) return false;
+
+		int32 QuantisedMax = 0;
+		if (!DecodeBase83(BlurHash, 1, 1, QuantisedMax)) return false;
+		const float MaxValue = (QuantisedMax + 1) / 166.f;
+
+		TArray<FLinearColor> Colors;
+		Colors.SetNum(NumX * NumY);
+
+		int32 Dc = 0;
+		if (!DecodeBase83(BlurHash, 2, 4, Dc)) return false;
+		Colors[0] = FLinearColor(SrgbToLinear(Dc >> 16), SrgbToLinear((Dc >> 8) & 255), SrgbToLinear(Dc & 255));
+
+		for (int32 i = 1; i < Colors.Num(); ++i)
+		{
+			int32 Ac = 0;
+			if (!DecodeBase83(BlurHash, 4 + i * 2, 2, Ac)) return false;
+			Colors[i] = FLinearColor(
+				SignPow((Ac / (19 * 19) - 9) / 9.f, 2.f) * MaxValue,
+				SignPow(((Ac / 19) % 19 - 9) / 9.f, 2.f) * MaxValue,
+				SignPow((Ac % 19 - 9) / 9.f, 2.f) * MaxValue);
+		}
+
+		// Cosine bases are separable; precompute them per axis
+		TArray<float> CosX, CosY;
+		CosX.SetNum(Width * NumX);
+		CosY.SetNum(Height * NumY);
+		for (int32 x = 0; x < Width; ++x)
+		{
+			for (int32 i = 0; i < NumX; ++i) { CosX[x * NumX + i] = FMath::Cos(PI * x * i / Width); }
+		}
+		for (int32 y = 0; y < Height; ++y)
+		{
+			for (int32 j = 0; j < NumY; ++j) { CosY[y * NumY + j] = FMath::Cos(PI * y * j / Height); }
+		}
+
+		OutPixels.SetNumUninitialized(Width * Height);
+		for (int32 y = 0; y < Height; ++y)
+		{
+			for (int32 x = 0; x < Width; ++x)
+			{
+				FLinearColor Pixel(0.f, 0.f, 0.f, 0.f);
+				for (int32 j = 0; j < NumY; ++j)
+				{
+					for (int32 i = 0; i < NumX; ++i)
+					{
+						Pixel += Colors[j * NumX + i] * (CosX[x * NumX + i] * CosY[y * NumY + j]);
+					}
+				}
+				OutPixels[y * Width + x] = FColor(LinearToSrgb(Pixel.R), LinearToSrgb(Pixel.G), LinearToSrgb(Pixel.B), 255);
+			}
+		}
+
+		return true;
+	}
+}
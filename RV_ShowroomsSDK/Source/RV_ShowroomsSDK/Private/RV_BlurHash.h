@@ -0,0 +1,10 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Minimal blurhash decoder (https://blurha.sh) used for showroom image placeholders
+namespace RV_BlurHash
+{
+	// Decodes BlurHash into Width x Height sRGB pixels. Returns false if the hash is malformed.
+	bool Decode(const FString& BlurHash, int32 Width, int32 Height, TArray<FColor>& OutPixels);
+}
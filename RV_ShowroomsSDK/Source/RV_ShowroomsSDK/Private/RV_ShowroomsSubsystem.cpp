@@ -1,10 +1,14 @@
 #include "RV_ShowroomsSubsystem.h"
+#include "RV_BlurHash.h"
+#include "RV_TrailerStreamer.h"
 
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonObjectConverter.h"
 #include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "Runtime/Launch/Resources/Version.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
 #include "HAL/PlatformProcess.h"
@@ -104,6 +108,7 @@ void URV_ShowroomsSubsystem::ListShowrooms(const FRV_ShowroomsListResult& OnComp
 			TArray<FRV_ShowroomSummary> Out;
 			if (ParseShowroomsJson(Resp->GetContentAsString(), Out))
 			{
+				for (FRV_ShowroomSummary& S : Out) { ResolvePlaceholderTextures(S); }
 				OnComplete.ExecuteIfBound(true, Out, TEXT(""));
 			}
 			else
@@ -143,6 +148,7 @@ void URV_ShowroomsSubsystem::GetShowroomById(const FString& ShowroomId, const FR
 			FRV_ShowroomDetails Details;
 			if (ParseShowroomJson(Resp->GetContentAsString(), Details))
 			{
+				ResolvePlaceholderTextures(Details);
 				OnComplete.ExecuteIfBound(true,Details, TEXT(""));
 			}
 			else
@@ -162,14 +168,126 @@ void URV_ShowroomsSubsystem::GetShowroomById(const FString& ShowroomId, const FR
 	Request->ProcessRequest();
 }
 
+void URV_ShowroomsSubsystem::GetShowroomBundle(const FString& ShowroomId, const FRV_ShowroomDetailsResult& OnComplete)
+{
+	FetchShowroomBundle(ShowroomId, [OnComplete](bool bSuccess, const FRV_ShowroomDetails& Details, const FString& Error)
+	{
+		OnComplete.ExecuteIfBound(bSuccess, Details, Error);
+	});
+}
+
+void URV_ShowroomsSubsystem::FetchShowroomBundle(const FString& ShowroomId, TFunction<void(bool, const FRV_ShowroomDetails&, const FString&)> OnComplete)
+{
+	if (!EnsureApiUrl()) { OnComplete(false, FRV_ShowroomDetails(), TEXT("Missing ApiBaseUrl")); return; }
+
+	const FString Url = ApiBaseUrl.TrimEnd() + TEXT("/api/showroom/games/") + ShowroomId + TEXT("/bundle");
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	Request->OnProcessRequestComplete().BindLambda([this, OnComplete](FHttpRequestPtr Req, FHttpResponsePtr Resp, bool bOk)
+	{
+		if (!bOk || !Resp.IsValid())
+		{
+			OnComplete(false, FRV_ShowroomDetails(), TEXT("Network error"));
+			return;
+		}
+
+		if (Resp->GetResponseCode() >= 200 && Resp->GetResponseCode() < 300)
+		{
+			FRV_ShowroomDetails Details;
+			if (ParseShowroomBundleJson(Resp->GetContentAsString(), Details))
+			{
+				ResolvePlaceholderTextures(Details);
+				OnComplete(true, Details, TEXT(""));
+			}
+			else
+			{
+				OnComplete(false, FRV_ShowroomDetails(), TEXT("Parse error"));
+			}
+		}
+		else
+		{
+			OnComplete(false, FRV_ShowroomDetails(), FString::Printf(TEXT("HTTP %d"), Resp->GetResponseCode()));
+		}
+	});
+
+	Request->SetURL(Url);
+	Request->SetVerb(TEXT("GET"));
+	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	Request->ProcessRequest();
+}
+
 void URV_ShowroomsSubsystem::LoadShowroom(const FString& ShowroomId)
 {
 	UE_LOG(LogTemp, Log, TEXT("Loading showroom: %s"), *ShowroomId);
 	
-	// Use the existing GetShowroomById function but with multicast delegate
+	// The bundle carries details and signed media in one request; broadcast via multicast delegate
 	FRV_ShowroomDetailsResult OnComplete;
 	OnComplete.BindUFunction(this, FName("OnShowroomLoadComplete"));
-	GetShowroomById(ShowroomId, OnComplete);
+	GetShowroomBundle(ShowroomId, OnComplete);
+}
+
+// Prefers bundle media, which also carries the stored file size, over the plain trailerUrl
+static void FindTrailerMedia(const FRV_ShowroomDetails& Showroom, FString& OutUrl, int64& OutSizeBytes)
+{
+	OutUrl = Showroom.trailerUrl;
+	OutSizeBytes = 0;
+	for (const FRV_ShowroomMedia& Media : Showroom.media)
+	{
+		if (Media.kind == TEXT("trailer") && !Media.url.IsEmpty())
+		{
+			OutUrl = Media.url;
+			OutSizeBytes = Media.sizeBytes;
+			return;
+		}
+	}
+}
+
+URV_TrailerStreamer* URV_ShowroomsSubsystem::CreateTrailerStreamer(const FRV_ShowroomDetails& Showroom)
+{
+	FString Url;
+	int64 SizeBytes = 0;
+	FindTrailerMedia(Showroom, Url, SizeBytes);
+
+	if (Url.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Showroom %s has no trailer to stream"), *Showroom.id);
+		return nullptr;
+	}
+
+	URV_TrailerStreamer* Streamer = NewObject<URV_TrailerStreamer>(this);
+	Streamer->SourceUrl = Url;
+	Streamer->ExpectedSizeBytes = SizeBytes;
+
+	// Signed URLs expire; re-fetch the bundle so a long or resumed download can continue
+	if (!Showroom.id.IsEmpty())
+	{
+		TWeakObjectPtr<URV_ShowroomsSubsystem> WeakThis(this);
+		const FString ShowroomId = Showroom.id;
+		Streamer->RefreshUrl.BindLambda([WeakThis, ShowroomId](TFunction<void(const FString&)> OnRefreshed)
+		{
+			URV_ShowroomsSubsystem* Subsystem = WeakThis.Get();
+			if (!Subsystem)
+			{
+				OnRefreshed(FString());
+				return;
+			}
+			Subsystem->FetchShowroomBundle(ShowroomId, [OnRefreshed](bool bSuccess, const FRV_ShowroomDetails& Details, const FString& Error)
+			{
+				FString NewUrl;
+				int64 NewSizeBytes = 0;
+				if (bSuccess)
+				{
+					FindTrailerMedia(Details, NewUrl, NewSizeBytes);
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Failed to refresh trailer URL: %s"), *Error);
+				}
+				OnRefreshed(NewUrl);
+			});
+		});
+	}
+	return Streamer;
 }
 
 static bool JsonTryGetString(const TSharedPtr<FJsonObject>& Obj, const FString& Key, FString& Out)
@@ -194,7 +312,7 @@ bool URV_ShowroomsSubsystem::EnsureApiUrl()
 	return true;
 }
 
-FLinearColor URV_ShowroomsSubsystem::HexStringToLinearColor(const FString& HexString) const
+FLinearColor URV_ShowroomsSubsystem::HexStringToLinearColor(const FString& HexString, const FLinearColor& Fallback) const
 {
 	FString CleanHex = HexString.TrimStartAndEnd();
 	
@@ -207,13 +325,73 @@ FLinearColor URV_ShowroomsSubsystem::HexStringToLinearColor(const FString& HexSt
 	// Ensure we have a valid hex string
 	if (CleanHex.Len() != 6)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid hex color string: %s, using default color"), *HexString);
-		return FLinearColor::White;
+		UE_LOG(LogTemp, Warning, TEXT("Invalid hex color string: %s, using fallback color"), *HexString);
+		return Fallback;
 	}
 	
 	return FLinearColor(FColor::FromHex(CleanHex));
 }
 
+bool URV_ShowroomsSubsystem::ParseImagePlaceholder(const TSharedPtr<FJsonObject>& Obj, const FString& Key, FRV_ImagePlaceholder& OutPlaceholder) const
+{
+	const TSharedPtr<FJsonObject>* PlaceholderObj = nullptr;
+	if (!Obj.IsValid() || !Obj->TryGetObjectField(Key, PlaceholderObj) || !PlaceholderObj) return false;
+
+	JsonTryGetString(*PlaceholderObj, TEXT("blurHash"), OutPlaceholder.blurHash);
+	if (JsonTryGetString(*PlaceholderObj, TEXT("dominantColor"), OutPlaceholder.dominantColor))
+	{
+		OutPlaceholder.dominantColorLinear = HexStringToLinearColor(OutPlaceholder.dominantColor, FLinearColor::Black);
+	}
+	if (JsonTryGetString(*PlaceholderObj, TEXT("accentColor"), OutPlaceholder.accentColor))
+	{
+		OutPlaceholder.accentColorLinear = HexStringToLinearColor(OutPlaceholder.accentColor, OutPlaceholder.dominantColorLinear);
+	}
+	return true;
+}
+
+void URV_ShowroomsSubsystem::ResolvePlaceholderTextures(FRV_ShowroomSummary& Showroom)
+{
+	Showroom.gameLogoPlaceholder.texture = GetPlaceholderTexture(Showroom.gameLogoPlaceholder.blurHash);
+	Showroom.coverArtPlaceholder.texture = GetPlaceholderTexture(Showroom.coverArtPlaceholder.blurHash);
+}
+
+UTexture2D* URV_ShowroomsSubsystem::GetPlaceholderTexture(const FString& BlurHash)
+{
+	if (BlurHash.IsEmpty()) return nullptr;
+
+	if (UTexture2D** Cached = PlaceholderTextureCache.Find(BlurHash))
+	{
+		return *Cached;
+	}
+
+	const int32 Size = FMath::Clamp(PlaceholderTextureSize, 4, 128);
+	TArray<FColor> Pixels;
+	if (!RV_BlurHash::Decode(BlurHash, Size, Size, Pixels))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid blurhash: %s"), *BlurHash);
+		return nullptr;
+	}
+
+	UTexture2D* Texture = UTexture2D::CreateTransient(Size, Size, PF_B8G8R8A8);
+	if (!Texture) return nullptr;
+
+	Texture->SRGB = true;
+	Texture->Filter = TF_Bilinear;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+#else
+	FTexturePlatformData* PlatformData = Texture->PlatformData;
+#endif
+	void* MipData = PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(MipData, Pixels.GetData(), Pixels.Num() * sizeof(FColor));
+	PlatformData->Mips[0].BulkData.Unlock();
+	Texture->UpdateResource();
+
+	PlaceholderTextureCache.Add(BlurHash, Texture);
+	return Texture;
+}
+
 
 
 bool URV_ShowroomsSubsystem::ParseShowroomsJson(const FString& Json, TArray<FRV_ShowroomSummary>& OutList) const
@@ -240,9 +418,12 @@ bool URV_ShowroomsSubsystem::ParseShowroomsJson(const FString& Json, TArray<FRV_
 		JsonTryGetString(Obj, TEXT("coverArtUrl"), S.coverArtUrl);
 		JsonTryGetString(Obj, TEXT("showroomTier"), S.showroomTier);
 		JsonTryGetString(Obj, TEXT("showroomLightingColor"), S.showroomLightingColor);
+		ParseImagePlaceholder(Obj, TEXT("gameLogoPlaceholder"), S.gameLogoPlaceholder);
+		ParseImagePlaceholder(Obj, TEXT("coverArtPlaceholder"), S.coverArtPlaceholder);
 		
-		// Convert hex color string to FLinearColor
-		S.showroomLightingColorLinear = HexStringToLinearColor(S.showroomLightingColor);
+		// Convert hex color string to FLinearColor, falling back to the cover art's dominant color
+		const FLinearColor LightingFallback = S.coverArtPlaceholder.dominantColor.IsEmpty() ? FLinearColor::White : S.coverArtPlaceholder.dominantColorLinear;
+		S.showroomLightingColorLinear = HexStringToLinearColor(S.showroomLightingColor, LightingFallback);
 
 		OutList.Add(MoveTemp(S));
 	}
@@ -256,6 +437,50 @@ bool URV_ShowroomsSubsystem::ParseShowroomJson(const FString& Json, FRV_Showroom
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
 	if (!FJsonSerializer::Deserialize(Reader, Obj) || !Obj.IsValid()) return false;
 
+	return ParseShowroomObject(Obj, OutDetails);
+}
+
+bool URV_ShowroomsSubsystem::ParseShowroomBundleJson(const FString& Json, FRV_ShowroomDetails& OutDetails) const
+{
+	TSharedPtr<FJsonObject> Obj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(Reader, Obj) || !Obj.IsValid()) return false;
+
+	const TSharedPtr<FJsonObject>* GameObj = nullptr;
+	if (!Obj->TryGetObjectField(TEXT("game"), GameObj) || !GameObj) return false;
+	if (!ParseShowroomObject(*GameObj, OutDetails)) return false;
+
+	FString GeneratedAt;
+	if (JsonTryGetString(Obj, TEXT("generatedAt"), GeneratedAt)) { FDateTime::ParseIso8601(*GeneratedAt, OutDetails.generatedAt); }
+	Obj->TryGetNumberField(TEXT("urlExpiresInSeconds"), OutDetails.urlExpiresInSeconds);
+
+	const TArray<TSharedPtr<FJsonValue>>* MediaArr = nullptr;
+	if (Obj->TryGetArrayField(TEXT("media"), MediaArr) && MediaArr)
+	{
+		for (const auto& V : *MediaArr)
+		{
+			const TSharedPtr<FJsonObject> MediaObj = V->AsObject();
+			if (!MediaObj.IsValid()) continue;
+
+			FRV_ShowroomMedia Media;
+			JsonTryGetString(MediaObj, TEXT("kind"), Media.kind);
+			JsonTryGetString(MediaObj, TEXT("url"), Media.url);
+			JsonTryGetString(MediaObj, TEXT("contentType"), Media.contentType);
+			MediaObj->TryGetNumberField(TEXT("sizeBytes"), Media.sizeBytes);
+			MediaObj->TryGetNumberField(TEXT("width"), Media.width);
+			MediaObj->TryGetNumberField(TEXT("height"), Media.height);
+			MediaObj->TryGetNumberField(TEXT("durationSeconds"), Media.durationSeconds);
+			OutDetails.media.Add(MoveTemp(Media));
+		}
+	}
+
+	return true;
+}
+
+bool URV_ShowroomsSubsystem::ParseShowroomObject(const TSharedPtr<FJsonObject>& Obj, FRV_ShowroomDetails& OutDetails) const
+{
+	if (!Obj.IsValid()) return false;
+
 	FRV_ShowroomSummary& Base = OutDetails;
 	JsonTryGetString(Obj, TEXT("id"), Base.id);
 	JsonTryGetString(Obj, TEXT("name"), Base.name);
@@ -269,9 +494,12 @@ bool URV_ShowroomsSubsystem::ParseShowroomJson(const FString& Json, FRV_Showroom
 	JsonTryGetString(Obj, TEXT("coverArtUrl"), Base.coverArtUrl);
 	JsonTryGetString(Obj, TEXT("showroomTier"), Base.showroomTier);
 	JsonTryGetString(Obj, TEXT("showroomLightingColor"), Base.showroomLightingColor);
+	ParseImagePlaceholder(Obj, TEXT("gameLogoPlaceholder"), Base.gameLogoPlaceholder);
+	ParseImagePlaceholder(Obj, TEXT("coverArtPlaceholder"), Base.coverArtPlaceholder);
 	
-	// Convert hex color string to FLinearColor
-	Base.showroomLightingColorLinear = HexStringToLinearColor(Base.showroomLightingColor);
+	// Convert hex color string to FLinearColor, falling back to the cover art's dominant color
+	const FLinearColor LightingFallback = Base.coverArtPlaceholder.dominantColor.IsEmpty() ? FLinearColor::White : Base.coverArtPlaceholder.dominantColorLinear;
+	Base.showroomLightingColorLinear = HexStringToLinearColor(Base.showroomLightingColor, LightingFallback);
 
 	JsonTryGetString(Obj, TEXT("trailerUrl"), OutDetails.trailerUrl);
 	JsonTryGetString(Obj, TEXT("gameUrl"), OutDetails.gameUrl);
@@ -389,7 +617,7 @@ void URV_ShowroomsSubsystem::OpenShowroomFromDeepLink(const FString& ProjectId)
 	PendingDeepLinkShowroomId = ProjectId;
 	PendingDeepLinkShowroomJson.Empty();
 	
-	// Load the showroom from server - this will trigger the OnShowroomLoaded multicast delegate
+	// Load the showroom bundle from server (single request) - this will trigger the OnShowroomLoaded multicast delegate
 	LoadShowroom(ProjectId);
 	
 	// Show immediate feedback
@@ -419,6 +647,7 @@ void URV_ShowroomsSubsystem::OpenShowroomFromDeepLinkWithData(const FString& Sho
 		if (ParseShowroomJson(ShowroomJson, ShowroomDetails))
 		{
 			UE_LOG(LogTemp, Log, TEXT("Showroom data parsed successfully: %s"), *ShowroomDetails.name);
+			ResolvePlaceholderTextures(ShowroomDetails);
 			
 			// Broadcast the multicast delegate immediately (no server call needed)
 			OnShowroomLoaded.Broadcast(true, ShowroomDetails, TEXT(""));
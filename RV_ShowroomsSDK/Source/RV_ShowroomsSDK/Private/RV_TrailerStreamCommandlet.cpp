@@ -0,0 +1,179 @@
+#include "RV_TrailerStreamCommandlet.h"
+#include "RV_TrailerStreamer.h"
+
+#include "HttpModule.h"
+#include "HttpManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "IMediaModule.h"
+#include "MediaPlayer.h"
+#include "Containers/Ticker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+URV_TrailerStreamCommandlet::URV_TrailerStreamCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+static FString FormatMetricsRow(int32 Run, const TCHAR* Label, const URV_TrailerStreamer* Streamer)
+{
+	const FRV_TrailerStreamMetrics Metrics = Streamer->GetMetrics();
+	return FString::Printf(TEXT("%d,%s,%d,%lld,%lld,%d,%.3f,%.3f,%.3f,%.3f"),
+		Run, Label, Streamer->IsComplete() ? 1 : 0, Metrics.bytesFetched, Metrics.bytesFromCache, Metrics.rangeRequests,
+		Metrics.timeToFirstChunkSeconds, Metrics.timeToReadySeconds, Metrics.timeToFirstFrameSeconds, Metrics.timeToCompleteSeconds);
+}
+
+// The engine loop normally drives these; a commandlet has to pump them itself. The core ticker also runs the loopback HTTP listeners.
+static void TickLoop(float DeltaSeconds, IMediaModule* MediaModule)
+{
+	FHttpModule::Get().GetHttpManager().Tick(DeltaSeconds);
+#if ENGINE_MAJOR_VERSION >= 5
+	FTSTicker::GetCoreTicker().Tick(DeltaSeconds);
+#else
+	FTicker::GetCoreTicker().Tick(DeltaSeconds);
+#endif
+	if (MediaModule)
+	{
+		MediaModule->TickPreEngine();
+		MediaModule->TickInput(FTimespan::FromSeconds(DeltaSeconds), FTimespan::MinValue());
+		MediaModule->TickPostEngine();
+		MediaModule->TickPostRender();
+	}
+}
+
+void URV_TrailerStreamCommandlet::HandleReadyToPlay(const FString& PlaybackUrl)
+{
+	if (!Player) return;
+
+	Streamer->TrackFirstFrame(Player);
+	if (!Player->OpenUrl(PlaybackUrl))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RV_TrailerStream: media player could not open %s"), *PlaybackUrl);
+	}
+}
+
+int32 URV_TrailerStreamCommandlet::Main(const FString& Params)
+{
+	FString Url;
+	if (!FParse::Value(*Params, TEXT("Url="), Url) || Url.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("RV_TrailerStream: -Url=<trailer url> is required"));
+		return 1;
+	}
+
+	int32 Runs = 3;
+	int32 ChunkSize = 0;
+	int64 SizeBytes = 0;
+	int64 InterruptAt = 0;
+	float TimeoutSeconds = 300.f;
+	FString OutPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RV_Showrooms"), TEXT("TrailerMetrics.csv"));
+	FParse::Value(*Params, TEXT("Runs="), Runs);
+	FParse::Value(*Params, TEXT("ChunkSize="), ChunkSize);
+	FParse::Value(*Params, TEXT("Size="), SizeBytes);
+	FParse::Value(*Params, TEXT("InterruptAt="), InterruptAt);
+	FParse::Value(*Params, TEXT("Timeout="), TimeoutSeconds);
+	FParse::Value(*Params, TEXT("Out="), OutPath);
+	const bool bCold = FParse::Param(*Params, TEXT("Cold"));
+	const bool bPlay = FParse::Param(*Params, TEXT("Play"));
+
+	AddToRoot();
+	Streamer = NewObject<URV_TrailerStreamer>(this);
+	Streamer->OnReadyToPlay.AddDynamic(this, &URV_TrailerStreamCommandlet::HandleReadyToPlay);
+	Streamer->SourceUrl = Url;
+	Streamer->ExpectedSizeBytes = SizeBytes;
+	if (ChunkSize > 0)
+	{
+		Streamer->ChunkSizeBytes = ChunkSize;
+	}
+
+	if (bCold && !Streamer->ClearCachedFile())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("RV_TrailerStream: could not clear the cached trailer, run 0 may not be cold"));
+	}
+
+	IMediaModule* MediaModule = nullptr;
+	if (bPlay)
+	{
+		MediaModule = FModuleManager::LoadModulePtr<IMediaModule>(TEXT("Media"));
+		Player = NewObject<UMediaPlayer>(this);
+		Player->PlayOnOpen = true;
+	}
+
+	TArray<FString> Rows;
+	Rows.Add(TEXT("run,label,complete,bytesFetched,bytesFromCache,rangeRequests,timeToFirstChunkSeconds,timeToReadySeconds,timeToFirstFrameSeconds,timeToCompleteSeconds"));
+
+	bool bAllComplete = true;
+	for (int32 Run = 0; Run < FMath::Max(Runs, 1); ++Run)
+	{
+		const TCHAR* Label = Run > 0 ? TEXT("warm") : (bCold ? TEXT("cold") : TEXT("first"));
+		bool bInterrupted = InterruptAt <= 0 || Run > 0;
+
+		if (Player)
+		{
+			Player->Close();
+		}
+
+		Streamer->StartStreaming();
+		const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+		// With -Play, keep going after the download until the player shows a frame (or gives up)
+		auto IsWaiting = [this]()
+		{
+			if (Streamer->IsStreaming()) return true;
+			const FRV_TrailerStreamMetrics Metrics = Streamer->GetMetrics();
+			return Player && Metrics.timeToReadySeconds >= 0.f && Metrics.timeToFirstFrameSeconds < 0.f && !Player->IsClosed() && !Player->HasError();
+		};
+		while (IsWaiting() && FPlatformTime::Seconds() < Deadline)
+		{
+			TickLoop(0.01f, MediaModule);
+
+			if (!bInterrupted && Streamer->GetMetrics().bytesFetched >= InterruptAt)
+			{
+				// Player leaves the booth and comes straight back
+				bInterrupted = true;
+				Streamer->StopStreaming();
+				Rows.Add(FormatMetricsRow(Run, TEXT("interrupted"), Streamer));
+				Label = TEXT("resumed");
+				if (Player)
+				{
+					Player->Close();
+				}
+				Streamer->StartStreaming();
+			}
+
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		if (Streamer->IsStreaming())
+		{
+			UE_LOG(LogTemp, Error, TEXT("RV_TrailerStream: run %d timed out after %.0fs"), Run, TimeoutSeconds);
+			Streamer->StopStreaming();
+		}
+
+		bAllComplete &= Streamer->IsComplete();
+		Rows.Add(FormatMetricsRow(Run, Label, Streamer));
+		UE_LOG(LogTemp, Display, TEXT("RV_TrailerStream: %s"), *Rows.Last());
+	}
+
+	if (Player)
+	{
+		Player->Close();
+	}
+	RemoveFromRoot();
+
+	if (FFileHelper::SaveStringArrayToFile(Rows, *OutPath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("RV_TrailerStream: wrote %s"), *OutPath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("RV_TrailerStream: failed to write %s"), *OutPath);
+	}
+
+	return bAllComplete ? 0 : 1;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "RV_TrailerStreamCommandlet.generated.h"
+
+class URV_TrailerStreamer;
+class UMediaPlayer;
+
+/**
+ * Records URV_TrailerStreamer metrics against a trailer URL, e.g. one served by trailer-range-server.py.
+ * Usage: -run=RV_TrailerStream -Url=<url> [-Size=<bytes>] [-Runs=3] [-Cold] [-InterruptAt=<bytes>] [-ChunkSize=<bytes>] [-Timeout=<seconds>] [-Play] [-Out=<csv>]
+ * Run 0 starts cold with -Cold; later runs are warm (served from the disk cache). -InterruptAt stops run 0 once that many
+ * bytes were fetched and starts it again, measuring a player leaving and returning to the booth.
+ * -Play opens the playback URL in a UMediaPlayer on OnReadyToPlay and records time to first frame; it needs a media
+ * player plugin (Electra or WmfMedia) enabled in the project.
+ */
+UCLASS()
+class URV_TrailerStreamCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	URV_TrailerStreamCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	UFUNCTION()
+	void HandleReadyToPlay(const FString& PlaybackUrl);
+
+	UPROPERTY()
+	URV_TrailerStreamer* Streamer = nullptr;
+
+	UPROPERTY()
+	UMediaPlayer* Player = nullptr;
+};
@@ -0,0 +1,573 @@
+#include "RV_TrailerStreamer.h"
+
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+// Cache files owned by live streamers. Eviction never deletes these because the owner may have
+// handed the file to a media player; keep the streamer alive for as long as the file is open.
+static TMap<FString, int32> GPinnedTrailerFiles;
+
+void URV_TrailerStreamer::StartStreaming()
+{
+	if (bStreaming) return;
+
+	if (SourceUrl.IsEmpty())
+	{
+		Fail(TEXT("Missing SourceUrl"));
+		return;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*GetCacheDir());
+	ResolveCachePaths();
+	SetPinnedFile(LocalFilePath);
+	BindPlaybackRoute();
+
+	Metrics = FRV_TrailerStreamMetrics();
+	StartTime = FPlatformTime::Seconds();
+	RetryCount = 0;
+	bUrlRefreshed = false;
+	// A resumed partial file is only announced after the first chunk has revalidated it
+	bReadyBroadcast = false;
+	SessionId++;
+	bStreaming = true;
+
+	// Resume from whatever an earlier session left on disk; the sidecar holds the total size and the validator
+	TotalBytes = -1;
+	Validator.Reset();
+	TArray<FString> StoredInfo;
+	if (FFileHelper::LoadFileToStringArray(StoredInfo, *SizeFilePath) && StoredInfo.Num() > 0)
+	{
+		TotalBytes = FCString::Atoi64(*StoredInfo[0]);
+		Validator = StoredInfo.Num() > 1 ? StoredInfo[1] : FString();
+	}
+	BufferedBytes = FMath::Max<int64>(PlatformFile.FileSize(*LocalFilePath), 0);
+
+	// Trailer was replaced on the server (same key, different size) or cache is inconsistent
+	const bool bSizeMismatch = ExpectedSizeBytes > 0 && TotalBytes >= 0 && TotalBytes != ExpectedSizeBytes;
+	if (bSizeMismatch || (TotalBytes >= 0 && BufferedBytes > TotalBytes) || (TotalBytes < 0 && BufferedBytes > 0))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Discarding stale trailer cache %s"), *LocalFilePath);
+		if (!ResetCache()) return;
+	}
+	if (TotalBytes < 0 && ExpectedSizeBytes > 0)
+	{
+		TotalBytes = ExpectedSizeBytes;
+	}
+	Metrics.bytesFromCache = BufferedBytes;
+
+	if (IsComplete())
+	{
+		// The storage key survives re-uploads, so a complete file may still be an older version
+		RevalidateCache();
+		return;
+	}
+
+	// Make room for the rest of this trailer before writing it
+	const int64 RemainingBytes = TotalBytes >= 0 ? TotalBytes - BufferedBytes : 0;
+	EvictCache(RemainingBytes);
+
+	// Share read access so the cache can be inspected (or a finished file opened) while the handle is held
+	if (!FileHandle)
+	{
+		FileHandle.Reset(PlatformFile.OpenWrite(*LocalFilePath, true, true));
+	}
+	if (!FileHandle)
+	{
+		Fail(FString::Printf(TEXT("Failed to open trailer cache file %s"), *LocalFilePath));
+		return;
+	}
+
+	RequestNextChunk();
+}
+
+void URV_TrailerStreamer::StopStreaming(bool bDiscardPartial)
+{
+	const bool bWasStreaming = bStreaming;
+	bStreaming = false;
+	SessionId++;
+
+	// Reset before cancelling so the cancelled callback is ignored
+	FHttpRequestPtr Request = ActiveRequest;
+	ActiveRequest.Reset();
+	if (Request.IsValid())
+	{
+		Request->CancelRequest();
+	}
+
+	CloseFile();
+	ServicePlaybackReads();
+
+	// Another live streamer may be downloading the same trailer into the same file
+	if (bDiscardPartial && !IsComplete() && !LocalFilePath.IsEmpty() && GPinnedTrailerFiles.FindRef(LocalFilePath) <= 1)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.DeleteFile(*LocalFilePath);
+		PlatformFile.DeleteFile(*SizeFilePath);
+		BufferedBytes = 0;
+	}
+
+	if (bWasStreaming)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Trailer streaming stopped: fetched %lld bytes in %d range requests (%lld from cache), discard=%d"),
+			Metrics.bytesFetched, Metrics.rangeRequests, Metrics.bytesFromCache, bDiscardPartial ? 1 : 0);
+	}
+}
+
+bool URV_TrailerStreamer::ClearCachedFile()
+{
+	if (bStreaming || SourceUrl.IsEmpty()) return false;
+
+	ResolveCachePaths();
+	if (GPinnedTrailerFiles.FindRef(LocalFilePath) > (PinnedFilePath == LocalFilePath ? 1 : 0)) return false;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.DeleteFile(*SizeFilePath);
+	const bool bDeleted = !PlatformFile.FileExists(*LocalFilePath) || PlatformFile.DeleteFile(*LocalFilePath);
+	if (bDeleted)
+	{
+		BufferedBytes = 0;
+		TotalBytes = -1;
+	}
+	return bDeleted;
+}
+
+void URV_TrailerStreamer::BeginDestroy()
+{
+	if (ActiveRequest.IsValid())
+	{
+		FHttpRequestPtr Request = ActiveRequest;
+		ActiveRequest.Reset();
+		Request->OnProcessRequestComplete().Unbind();
+		Request->CancelRequest();
+	}
+	CloseFile();
+	bStreaming = false;
+	FirstFrameTrackId++;
+	UnbindPlaybackRoute();
+	SetPinnedFile(FString());
+
+	Super::BeginDestroy();
+}
+
+void URV_TrailerStreamer::RequestNextChunk()
+{
+	if (!bStreaming) return;
+
+	if (IsComplete())
+	{
+		FinishStreaming();
+		return;
+	}
+
+	int64 RangeEnd = BufferedBytes + FMath::Max(ChunkSizeBytes, 64 * 1024) - 1;
+	if (TotalBytes >= 0)
+	{
+		RangeEnd = FMath::Min(RangeEnd, TotalBytes - 1);
+	}
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	const int64 RequestedOffset = BufferedBytes;
+	TWeakObjectPtr<URV_TrailerStreamer> WeakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([WeakThis, RequestedOffset](FHttpRequestPtr Req, FHttpResponsePtr Resp, bool bOk)
+	{
+		if (URV_TrailerStreamer* Streamer = WeakThis.Get())
+		{
+			Streamer->HandleChunkResponse(Req, Resp, bOk, RequestedOffset);
+		}
+	});
+
+	Request->SetURL(SourceUrl);
+	Request->SetVerb(TEXT("GET"));
+	Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-%lld"), RequestedOffset, RangeEnd));
+	if (RequestedOffset > 0 && !Validator.IsEmpty())
+	{
+		// The server answers 200 with the whole new file if the trailer changed since the first chunk
+		Request->SetHeader(TEXT("If-Range"), Validator);
+	}
+	ActiveRequest = Request;
+	Metrics.rangeRequests++;
+	Request->ProcessRequest();
+}
+
+void URV_TrailerStreamer::HandleChunkResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded, int64 RequestedOffset)
+{
+	// Ignore responses for requests we already cancelled or replaced
+	if (!bStreaming || Request != ActiveRequest) return;
+	ActiveRequest.Reset();
+
+	if (!bSucceeded || !Response.IsValid())
+	{
+		RetryOrFail(TEXT("Network error"));
+		return;
+	}
+
+	const int32 Code = Response->GetResponseCode();
+	if (Code == 206)
+	{
+		int64 RangeStart = -1, RangeEnd = -1, RangeTotal = -1;
+		if (!ParseContentRange(Response->GetHeader(TEXT("Content-Range")), RangeStart, RangeEnd, RangeTotal) || RangeStart < 0 || RangeEnd < RangeStart)
+		{
+			RetryOrFail(TEXT("Missing or malformed Content-Range"));
+			return;
+		}
+
+		// A different validator means the bytes already on disk belong to another version of the file
+		const FString ResponseValidator = GetResponseValidator(Response);
+		if (RequestedOffset > 0 && !ResponseValidator.IsEmpty() && ResponseValidator != Validator)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Trailer changed on the server (%s -> %s), restarting download"), *Validator, *ResponseValidator);
+			if (!ResetCache()) return;
+			RequestNextChunk();
+			return;
+		}
+		if (RequestedOffset == 0 && ResponseValidator != Validator)
+		{
+			Validator = ResponseValidator;
+			SaveCacheInfo();
+		}
+
+		if (RangeTotal >= 0)
+		{
+			if (TotalBytes >= 0 && RangeTotal != TotalBytes)
+			{
+				// File changed on the server between sessions; start over
+				UE_LOG(LogTemp, Warning, TEXT("Trailer size changed (%lld -> %lld), restarting download"), TotalBytes, RangeTotal);
+				if (!ResetCache()) return;
+				TotalBytes = RangeTotal;
+				SaveCacheInfo();
+				RequestNextChunk();
+				return;
+			}
+			if (RequestedOffset == 0 || TotalBytes < 0 || !FPaths::FileExists(SizeFilePath))
+			{
+				TotalBytes = RangeTotal;
+				SaveCacheInfo();
+			}
+		}
+
+		// Appending bytes from any other offset would silently corrupt the cached file
+		if (RangeStart != RequestedOffset)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Trailer range starts at %lld, expected %lld; restarting download"), RangeStart, RequestedOffset);
+			if (!ResetCache()) return;
+			RetryOrFail(TEXT("Unexpected Content-Range offset"));
+			return;
+		}
+
+		const int64 ExpectedLength = RangeEnd - RangeStart + 1;
+		if (Response->GetContent().Num() != ExpectedLength)
+		{
+			RetryOrFail(FString::Printf(TEXT("Truncated range response (%d of %lld bytes)"), Response->GetContent().Num(), ExpectedLength));
+			return;
+		}
+		if (!AppendToCache(Response->GetContent())) return;
+	}
+	else if (Code == 200)
+	{
+		// Server ignored the Range header or If-Range failed (the file changed); either way this is the whole file
+		if (RequestedOffset > 0 && !ResetCache()) return;
+		TotalBytes = Response->GetContent().Num();
+		Validator = GetResponseValidator(Response);
+		SaveCacheInfo();
+		if (!AppendToCache(Response->GetContent())) return;
+	}
+	else if (Code == 416)
+	{
+		int64 RangeStart = -1, RangeEnd = -1, RangeTotal = -1;
+		ParseContentRange(Response->GetHeader(TEXT("Content-Range")), RangeStart, RangeEnd, RangeTotal);
+		if (RangeTotal >= 0 && BufferedBytes == RangeTotal)
+		{
+			TotalBytes = RangeTotal;
+			SaveCacheInfo();
+		}
+		else
+		{
+			if (!ResetCache()) return;
+			RetryOrFail(TEXT("HTTP 416"));
+			return;
+		}
+	}
+	else
+	{
+		// Server errors are worth retrying; client errors (e.g. expired signature) need a new URL
+		if (Code >= 500)
+		{
+			RetryOrFail(FString::Printf(TEXT("HTTP %d"), Code));
+		}
+		else if (Code >= 400 && RefreshUrl.IsBound() && !bUrlRefreshed)
+		{
+			RefreshSourceUrl(Code);
+		}
+		else
+		{
+			Fail(FString::Printf(TEXT("HTTP %d"), Code));
+		}
+		return;
+	}
+
+	RetryCount = 0;
+	bUrlRefreshed = false;
+	if (Metrics.timeToFirstChunkSeconds < 0.f)
+	{
+		Metrics.timeToFirstChunkSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+	}
+	OnProgress.Broadcast(BufferedBytes, TotalBytes);
+	CheckReadyToPlay();
+
+	// A listener may have stopped streaming from inside the broadcast
+	if (!bStreaming) return;
+
+	if (IsComplete())
+	{
+		FinishStreaming();
+	}
+	else
+	{
+		RequestNextChunk();
+	}
+}
+
+bool URV_TrailerStreamer::AppendToCache(const TArray<uint8>& Data)
+{
+	if (!FileHandle || (Data.Num() > 0 && !FileHandle->Write(Data.GetData(), Data.Num())))
+	{
+		Fail(FString::Printf(TEXT("Failed to write trailer cache file %s"), *LocalFilePath));
+		return false;
+	}
+	FileHandle->Flush();
+
+	BufferedBytes += Data.Num();
+	Metrics.bytesFetched += Data.Num();
+	ServicePlaybackReads();
+	return true;
+}
+
+bool URV_TrailerStreamer::ResetCache()
+{
+	CloseFile();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.DeleteFile(*LocalFilePath);
+	PlatformFile.DeleteFile(*SizeFilePath);
+	BufferedBytes = 0;
+	TotalBytes = -1;
+	Validator.Reset();
+	Metrics.bytesFromCache = 0;
+
+	if (bStreaming)
+	{
+		FileHandle.Reset(PlatformFile.OpenWrite(*LocalFilePath, false, true));
+		if (!FileHandle)
+		{
+			Fail(FString::Printf(TEXT("Failed to open trailer cache file %s"), *LocalFilePath));
+			return false;
+		}
+	}
+	return true;
+}
+
+void URV_TrailerStreamer::RetryOrFail(const FString& Error)
+{
+	if (RetryCount < MaxRetriesPerChunk)
+	{
+		RetryCount++;
+		UE_LOG(LogTemp, Warning, TEXT("Trailer chunk at %lld failed (%s), retry %d/%d"), BufferedBytes, *Error, RetryCount, MaxRetriesPerChunk);
+		RequestNextChunk();
+		return;
+	}
+	Fail(Error);
+}
+
+void URV_TrailerStreamer::RefreshSourceUrl(int32 Code)
+{
+	bUrlRefreshed = true;
+	UE_LOG(LogTemp, Log, TEXT("Trailer URL rejected with HTTP %d at %lld bytes, requesting a fresh URL"), Code, BufferedBytes);
+
+	TWeakObjectPtr<URV_TrailerStreamer> WeakThis(this);
+	const int32 RequestSessionId = SessionId;
+	RefreshUrl.Execute([WeakThis, RequestSessionId, Code](const FString& NewUrl)
+	{
+		// Ignore refreshes that land after the streamer was stopped or restarted
+		URV_TrailerStreamer* Streamer = WeakThis.Get();
+		if (!Streamer || !Streamer->bStreaming || Streamer->SessionId != RequestSessionId) return;
+
+		if (NewUrl.IsEmpty())
+		{
+			Streamer->Fail(FString::Printf(TEXT("HTTP %d"), Code));
+			return;
+		}
+		Streamer->SourceUrl = NewUrl;
+		Streamer->RequestNextChunk();
+	});
+}
+
+void URV_TrailerStreamer::FinishStreaming()
+{
+	CloseFile();
+	bStreaming = false;
+	Metrics.timeToCompleteSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+	UE_LOG(LogTemp, Log, TEXT("Trailer cached after %.3fs: %lld bytes fetched in %d range requests (%lld from cache)"),
+		Metrics.timeToCompleteSeconds, Metrics.bytesFetched, Metrics.rangeRequests, Metrics.bytesFromCache);
+	ServicePlaybackReads();
+	CheckReadyToPlay();
+	OnComplete.Broadcast(LocalFilePath);
+}
+
+void URV_TrailerStreamer::Fail(const FString& Error)
+{
+	UE_LOG(LogTemp, Error, TEXT("Trailer streaming failed: %s"), *Error);
+	CloseFile();
+	bStreaming = false;
+	ServicePlaybackReads();
+	OnFailed.Broadcast(Error);
+}
+
+void URV_TrailerStreamer::CloseFile()
+{
+	FileHandle.Reset();
+}
+
+void URV_TrailerStreamer::SaveCacheInfo() const
+{
+	FFileHelper::SaveStringToFile(FString::Printf(TEXT("%lld\n%s"), TotalBytes, *Validator), *SizeFilePath);
+}
+
+FString URV_TrailerStreamer::GetResponseValidator(const FHttpResponsePtr& Response)
+{
+	// Weak ETags are not allowed in If-Range; fall back to Last-Modified
+	const FString ETag = Response->GetHeader(TEXT("ETag"));
+	if (!ETag.IsEmpty() && !ETag.StartsWith(TEXT("W/")))
+	{
+		return ETag;
+	}
+	return Response->GetHeader(TEXT("Last-Modified"));
+}
+
+void URV_TrailerStreamer::RevalidateCache()
+{
+	// Ask for the last byte only, conditional on the stored validator: 206 means the file is unchanged,
+	// 200 carries the new version in full
+	if (TotalBytes <= 0)
+	{
+		FinishStreaming();
+		return;
+	}
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	TWeakObjectPtr<URV_TrailerStreamer> WeakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([WeakThis](FHttpRequestPtr Req, FHttpResponsePtr Resp, bool bOk)
+	{
+		if (URV_TrailerStreamer* Streamer = WeakThis.Get())
+		{
+			Streamer->HandleRevalidateResponse(Req, Resp, bOk);
+		}
+	});
+
+	Request->SetURL(SourceUrl);
+	Request->SetVerb(TEXT("GET"));
+	Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-%lld"), TotalBytes - 1, TotalBytes - 1));
+	if (!Validator.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-Range"), Validator);
+	}
+	ActiveRequest = Request;
+	Metrics.rangeRequests++;
+	Request->ProcessRequest();
+}
+
+void URV_TrailerStreamer::HandleRevalidateResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+	if (!bStreaming || Request != ActiveRequest) return;
+	ActiveRequest.Reset();
+
+	const int32 Code = bSucceeded && Response.IsValid() ? Response->GetResponseCode() : 0;
+	if (Code == 200)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Cached trailer %s is out of date, replacing it"), *LocalFilePath);
+		if (!ResetCache()) return;
+		TotalBytes = Response->GetContent().Num();
+		Validator = GetResponseValidator(Response);
+		SaveCacheInfo();
+		if (!AppendToCache(Response->GetContent())) return;
+		OnProgress.Broadcast(BufferedBytes, TotalBytes);
+		FinishStreaming();
+		return;
+	}
+
+	if (Code == 206 || Code == 416)
+	{
+		int64 RangeStart = -1, RangeEnd = -1, RangeTotal = -1;
+		ParseContentRange(Response->GetHeader(TEXT("Content-Range")), RangeStart, RangeEnd, RangeTotal);
+		const FString ResponseValidator = GetResponseValidator(Response);
+		const bool bChanged = Code == 416 || (RangeTotal >= 0 && RangeTotal != TotalBytes)
+			|| (!ResponseValidator.IsEmpty() && ResponseValidator != Validator);
+		if (bChanged)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Cached trailer %s is out of date, downloading again"), *LocalFilePath);
+			if (!ResetCache()) return;
+			Metrics.bytesFromCache = 0;
+			RequestNextChunk();
+			return;
+		}
+	}
+	else
+	{
+		// Offline or the URL expired: the cached copy is the best we have
+		UE_LOG(LogTemp, Warning, TEXT("Could not revalidate cached trailer (HTTP %d), using it as is"), Code);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Trailer served from disk cache: %s"), *LocalFilePath);
+	FPlatformFileManager::Get().GetPlatformFile().SetTimeStamp(*LocalFilePath, FDateTime::UtcNow());
+	FinishStreaming();
+}
+
+void URV_TrailerStreamer::ResolveCachePaths()
+{
+	// Signed URLs carry a token in the query string; key the cache on the stable path only
+	FString UrlPath = SourceUrl;
+	SourceUrl.Split(TEXT("?"), &UrlPath, nullptr);
+	const FString CacheKey = FMD5::HashAnsiString(*UrlPath);
+	const FString CacheDir = GetCacheDir();
+	LocalFilePath = FPaths::Combine(CacheDir, CacheKey + TEXT(".mp4"));
+	SizeFilePath = FPaths::Combine(CacheDir, CacheKey + TEXT(".size"));
+}
+
+FString URV_TrailerStreamer::GetCacheDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RV_Showrooms"), TEXT("Trailers"));
+}
+
+bool URV_TrailerStreamer::ParseContentRange(const FString& ContentRange, int64& OutStart, int64& OutEnd, int64& OutTotal)
+{
+	// e.g. "bytes 0-1048575/15728640", "bytes */15728640" (416) or "bytes 0-1048575/*"
+	OutStart = OutEnd = OutTotal = -1;
+
+	FString Unit, Spec;
+	if (!ContentRange.TrimStartAndEnd().Split(TEXT(" "), &Unit, &Spec) || Unit != TEXT("bytes")) return false;
+
+	FString Range, Total;
+	if (!Spec.Split(TEXT("/"), &Range, &Total)) return false;
+	Range.TrimStartAndEndInline();
+	Total.TrimStartAndEndInline();
+
+	if (!Total.IsEmpty() && Total != TEXT("*"))
+	{
+		if (!Total.IsNumeric()) return false;
+		OutTotal = FCString::Atoi64(*Total);
+	}
+
+	if (Range != TEXT("*"))
+	{
+		FString Start, End;
+		if (!Range.Split(TEXT("-"), &Start, &End) || !Start.IsNumeric() || !End.IsNumeric()) return false;
+		OutStart = FCString::Atoi64(*Start);
+		OutEnd = FCString::Atoi64(*End);
+	}
+	return true;
+}
@@ -0,0 +1,245 @@
+#include "RV_TrailerStreamer.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "MediaPlayer.h"
+#include "Containers/Ticker.h"
+#include "Misc/Paths.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+// Progressive playback: the cache file is exposed on a loopback Range endpoint. Unlike opening the file directly,
+// the endpoint reports the final size from the first response and holds reads past BufferedBytes until they arrive.
+
+namespace
+{
+	constexpr int32 HttpPartialContent = 206;
+	constexpr int32 HttpRangeNotSatisfiable = 416;
+	constexpr int32 HttpServiceUnavailable = 503;
+
+	TUniquePtr<FHttpServerResponse> MakeErrorResponse(int32 Code, int64 TotalBytes = -1)
+	{
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Error(static_cast<EHttpServerResponseCodes>(Code));
+		if (TotalBytes >= 0)
+		{
+			Response->Headers.Add(TEXT("Content-Range"), { FString::Printf(TEXT("bytes */%lld"), TotalBytes) });
+		}
+		return Response;
+	}
+}
+
+FString URV_TrailerStreamer::GetPlaybackUrl() const
+{
+	if (PlaybackRoute.IsValid())
+	{
+		return FString::Printf(TEXT("http://127.0.0.1:%d%s"), LoopbackPort, *PlaybackRoutePath);
+	}
+	return LocalFilePath;
+}
+
+void URV_TrailerStreamer::CheckReadyToPlay()
+{
+	if (bReadyBroadcast || LocalFilePath.IsEmpty()) return;
+
+	// Without the loopback endpoint a media player would read a truncated file, so wait for the whole trailer
+	if (!IsComplete())
+	{
+		if (!PlaybackRoute.IsValid() || TotalBytes < 0 || BufferedBytes < FMath::Min<int64>(PlaybackStartBytes, TotalBytes)) return;
+	}
+
+	bReadyBroadcast = true;
+	Metrics.timeToReadySeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+	UE_LOG(LogTemp, Log, TEXT("Trailer ready to play after %.3fs: %lld of %lld bytes buffered"), Metrics.timeToReadySeconds, BufferedBytes, TotalBytes);
+	OnReadyToPlay.Broadcast(GetPlaybackUrl());
+}
+
+void URV_TrailerStreamer::TrackFirstFrame(UMediaPlayer* Player)
+{
+	const int32 TrackId = ++FirstFrameTrackId;
+	if (!Player) return;
+
+	TWeakObjectPtr<URV_TrailerStreamer> WeakThis(this);
+	TWeakObjectPtr<UMediaPlayer> WeakPlayer(Player);
+	const FTickerDelegate PollFirstFrame = FTickerDelegate::CreateLambda([WeakThis, WeakPlayer, TrackId](float DeltaTime)
+	{
+		URV_TrailerStreamer* Streamer = WeakThis.Get();
+		UMediaPlayer* MediaPlayer = WeakPlayer.Get();
+		if (!Streamer || !MediaPlayer || Streamer->FirstFrameTrackId != TrackId) return false;
+
+		// The playback clock only advances once the player has presented a sample
+		if (!MediaPlayer->IsPlaying() || MediaPlayer->GetTime() <= FTimespan::Zero()) return true;
+
+		Streamer->Metrics.timeToFirstFrameSeconds = static_cast<float>(FPlatformTime::Seconds() - Streamer->StartTime);
+		UE_LOG(LogTemp, Log, TEXT("Trailer first frame after %.3fs (%lld bytes buffered)"), Streamer->Metrics.timeToFirstFrameSeconds, Streamer->BufferedBytes);
+		return false;
+	});
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FTSTicker::GetCoreTicker().AddTicker(PollFirstFrame);
+#else
+	FTicker::GetCoreTicker().AddTicker(PollFirstFrame);
+#endif
+}
+
+void URV_TrailerStreamer::BindPlaybackRoute()
+{
+	if (LoopbackPort <= 0 || LocalFilePath.IsEmpty()) return;
+
+	const FString RoutePath = FString::Printf(TEXT("/rv_trailers/%s"), *FPaths::GetCleanFilename(LocalFilePath));
+	if (PlaybackRoute.IsValid() && RoutePath == PlaybackRoutePath) return;
+	UnbindPlaybackRoute();
+
+	TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(LoopbackPort);
+	if (!Router.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Trailer playback endpoint unavailable on port %d; playback starts when the download completes"), LoopbackPort);
+		return;
+	}
+
+	TWeakObjectPtr<URV_TrailerStreamer> WeakThis(this);
+	auto Handler = [WeakThis](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		URV_TrailerStreamer* Streamer = WeakThis.Get();
+		return Streamer ? Streamer->HandlePlaybackRequest(Request, OnComplete) : false;
+	};
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	PlaybackRoute = Router->BindRoute(FHttpPath(RoutePath), EHttpServerRequestVerbs::VERB_GET, FHttpRequestHandler::CreateLambda(MoveTemp(Handler)));
+#else
+	PlaybackRoute = Router->BindRoute(FHttpPath(RoutePath), EHttpServerRequestVerbs::VERB_GET, FHttpRequestHandler(MoveTemp(Handler)));
+#endif
+
+	if (!PlaybackRoute.IsValid())
+	{
+		// Another live streamer is already serving this trailer
+		UE_LOG(LogTemp, Warning, TEXT("Could not bind trailer playback route %s; playback starts when the download completes"), *RoutePath);
+		return;
+	}
+
+	PlaybackRoutePath = RoutePath;
+	FHttpServerModule::Get().StartAllListeners();
+}
+
+void URV_TrailerStreamer::UnbindPlaybackRoute()
+{
+	if (PlaybackRoute.IsValid())
+	{
+		TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(LoopbackPort);
+		if (Router.IsValid())
+		{
+			Router->UnbindRoute(PlaybackRoute);
+		}
+		PlaybackRoute.Reset();
+	}
+	PlaybackRoutePath.Reset();
+
+	// Nothing will serve these any more
+	for (FPlaybackRead& Read : PendingPlaybackReads)
+	{
+		Read.OnComplete(MakeErrorResponse(HttpServiceUnavailable));
+	}
+	PendingPlaybackReads.Reset();
+}
+
+bool URV_TrailerStreamer::HandlePlaybackRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	FPlaybackRead Read;
+	Read.OnComplete = OnComplete;
+
+	// Media players always send Range; treat a missing header as "bytes=0-" since responses are never the whole file
+	const TArray<FString>* RangeValues = Request.Headers.Find(TEXT("Range"));
+	if (RangeValues && RangeValues->Num() > 0)
+	{
+		FString Spec = (*RangeValues)[0].TrimStartAndEnd();
+		FString Start, End;
+		if (!Spec.RemoveFromStart(TEXT("bytes=")) || !Spec.Split(TEXT("-"), &Start, &End) || (Start.IsEmpty() && End.IsEmpty())
+			|| (!Start.IsEmpty() && !Start.IsNumeric()) || (!End.IsEmpty() && !End.IsNumeric()))
+		{
+			OnComplete(MakeErrorResponse(HttpRangeNotSatisfiable, TotalBytes));
+			return true;
+		}
+
+		if (Start.IsEmpty())
+		{
+			Read.SuffixLength = FCString::Atoi64(*End);
+		}
+		else
+		{
+			Read.Start = FCString::Atoi64(*Start);
+			Read.End = End.IsEmpty() ? -1 : FCString::Atoi64(*End);
+		}
+	}
+
+	PendingPlaybackReads.Add(MoveTemp(Read));
+	ServicePlaybackReads();
+	return true;
+}
+
+void URV_TrailerStreamer::ServicePlaybackReads()
+{
+	if (PendingPlaybackReads.Num() == 0) return;
+
+	// While stopped or failed nothing new will arrive; let the player fail instead of hanging
+	const bool bCanWait = bStreaming;
+
+	for (int32 Index = 0; Index < PendingPlaybackReads.Num();)
+	{
+		FPlaybackRead& Read = PendingPlaybackReads[Index];
+		TUniquePtr<FHttpServerResponse> Response;
+
+		if (TotalBytes < 0)
+		{
+			if (!bCanWait) Response = MakeErrorResponse(HttpServiceUnavailable);
+		}
+		else
+		{
+			int64 Start = Read.SuffixLength > 0 ? FMath::Max<int64>(TotalBytes - Read.SuffixLength, 0) : Read.Start;
+			int64 End = (Read.End < 0 || Read.End >= TotalBytes) ? TotalBytes - 1 : Read.End;
+
+			if (Start >= TotalBytes || Start > End)
+			{
+				Response = MakeErrorResponse(HttpRangeNotSatisfiable, TotalBytes);
+			}
+			else if (Start >= BufferedBytes)
+			{
+				if (!bCanWait) Response = MakeErrorResponse(HttpServiceUnavailable);
+			}
+			else
+			{
+				// Serve what is on disk, at most one chunk; players issue follow-up requests for the rest
+				End = FMath::Min3<int64>(End, BufferedBytes - 1, Start + ChunkSizeBytes - 1);
+				TArray<uint8> Data;
+				Data.SetNumUninitialized(static_cast<int32>(End - Start + 1));
+
+				// The download handle is opened with read sharing, so a second handle can read while it appends
+				TUniquePtr<IFileHandle> Reader(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*LocalFilePath, true));
+				if (Reader && Reader->Seek(Start) && Reader->Read(Data.GetData(), Data.Num()))
+				{
+					Response = FHttpServerResponse::Create(MoveTemp(Data), TEXT("video/mp4"));
+					Response->Code = static_cast<EHttpServerResponseCodes>(HttpPartialContent);
+					Response->Headers.Add(TEXT("Content-Range"), { FString::Printf(TEXT("bytes %lld-%lld/%lld"), Start, End, TotalBytes) });
+					Response->Headers.Add(TEXT("Accept-Ranges"), { TEXT("bytes") });
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Failed to read %lld-%lld from trailer cache %s"), Start, End, *LocalFilePath);
+					Response = MakeErrorResponse(HttpServiceUnavailable);
+				}
+			}
+		}
+
+		if (!Response)
+		{
+			++Index;
+			continue;
+		}
+
+		FHttpResultCallback OnComplete = MoveTemp(Read.OnComplete);
+		PendingPlaybackReads.RemoveAt(Index);
+		OnComplete(MoveTemp(Response));
+	}
+}
@@ -4,6 +4,63 @@
 
 #include "RV_ShowroomModels.generated.h"
 
+class UTexture2D;
+
+USTRUCT(BlueprintType)
+struct FRV_ImagePlaceholder
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString blurHash;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString dominantColor;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString accentColor;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FLinearColor dominantColorLinear = FLinearColor::Black;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FLinearColor accentColorLinear = FLinearColor::Black;
+
+	// Small texture decoded locally from blurHash; shown until the full image has downloaded
+	UPROPERTY(BlueprintReadOnly, Transient, Category="Readyverse|Showroom")
+	UTexture2D* texture = nullptr;
+};
+
+USTRUCT(BlueprintType)
+struct FRV_ShowroomMedia
+{
+	GENERATED_BODY()
+
+	// app_icon, hero_image, trailer or screenshot
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString kind;
+
+	// Already signed; valid for the bundle's urlExpiresInSeconds
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString url;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FString contentType;
+
+	// 0 when the server has no size recorded for this file
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	int64 sizeBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	int32 width = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	int32 height = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	int32 durationSeconds = 0;
+};
+
 USTRUCT(BlueprintType)
 struct FRV_ShowroomSummary
 {
@@ -39,6 +96,12 @@ struct FRV_ShowroomSummary
 	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
 	FString coverArtUrl;
 
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FRV_ImagePlaceholder gameLogoPlaceholder;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FRV_ImagePlaceholder coverArtPlaceholder;
+
 	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
 	FString showroomTier;
 
@@ -74,6 +137,18 @@ struct FRV_ShowroomDetails : public FRV_ShowroomSummary
 
 	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
 	FDateTime updatedAt;
+
+	// Only filled when loaded through the bundle endpoint (LoadShowroom / GetShowroomBundle)
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	TArray<FRV_ShowroomMedia> media;
+
+	// When the server generated the bundle's signed URLs (UTC)
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	FDateTime generatedAt;
+
+	// Remaining signed URL lifetime at the time the bundle was served; 0 if not loaded through the bundle endpoint
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Showroom")
+	int32 urlExpiresInSeconds = 0;
 };
 
 
@@ -6,6 +6,9 @@
 
 #include "RV_ShowroomsSubsystem.generated.h"
 
+class FJsonObject;
+class URV_TrailerStreamer;
+
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FRV_ShowroomsListResult, bool, bSuccess, const TArray<FRV_ShowroomSummary>&, Showrooms, const FString&, Error);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FRV_ShowroomDetailsResult, bool, bSuccess, const FRV_ShowroomDetails&, Showroom, const FString&, Error);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FRV_DeepLinkResult, bool, bSuccess, const FString&, Error);
@@ -24,6 +27,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Config")
 	bool bAutoRegisterDeepLink = true;
 
+	// Width/height of textures decoded from image placeholders (blurhash)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Config", meta=(ClampMin="4", ClampMax="128"))
+	int32 PlaceholderTextureSize = 32;
+
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
 	UFUNCTION(BlueprintCallable, Category="Readyverse|Showroom")
@@ -32,9 +39,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Readyverse|Showroom")
 	void GetShowroomById(const FString& ShowroomId, const FRV_ShowroomDetailsResult& OnComplete);
 
+	// Details plus signed media URLs, sizes and content types in a single request
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Showroom")
+	void GetShowroomBundle(const FString& ShowroomId, const FRV_ShowroomDetailsResult& OnComplete);
+
 	UFUNCTION(BlueprintCallable, Category="Readyverse|Showroom")
 	void LoadShowroom(const FString& ShowroomId);
 
+	// Creates (but does not start) a range-request streamer for the showroom trailer; null if there is no trailer.
+	// Bind its events, call StartStreaming when the player approaches the booth and StopStreaming when they leave.
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Trailer")
+	URV_TrailerStreamer* CreateTrailerStreamer(const FRV_ShowroomDetails& Showroom);
+
+	// Decodes a blurhash into a small transient texture (cached per hash)
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Showroom")
+	UTexture2D* GetPlaceholderTexture(const FString& BlurHash);
+
 	// Deep Link Handling
 	UFUNCTION(BlueprintCallable, Category="Readyverse|DeepLink")
 	void HandleDeepLink(const FString& DeepLinkUrl, const FRV_DeepLinkResult& OnComplete);
@@ -67,9 +87,18 @@ public:
 
 private:
 	bool EnsureApiUrl();
+	void FetchShowroomBundle(const FString& ShowroomId, TFunction<void(bool, const FRV_ShowroomDetails&, const FString&)> OnComplete);
 	bool ParseShowroomsJson(const FString& Json, TArray<FRV_ShowroomSummary>& OutList) const;
 	bool ParseShowroomJson(const FString& Json, FRV_ShowroomDetails& OutDetails) const;
-	FLinearColor HexStringToLinearColor(const FString& HexString) const;
+	bool ParseShowroomObject(const TSharedPtr<FJsonObject>& Obj, FRV_ShowroomDetails& OutDetails) const;
+	bool ParseShowroomBundleJson(const FString& Json, FRV_ShowroomDetails& OutDetails) const;
+	bool ParseImagePlaceholder(const TSharedPtr<FJsonObject>& Obj, const FString& Key, FRV_ImagePlaceholder& OutPlaceholder) const;
+	FLinearColor HexStringToLinearColor(const FString& HexString, const FLinearColor& Fallback = FLinearColor::White) const;
+	void ResolvePlaceholderTextures(FRV_ShowroomSummary& Showroom);
+
+	// Keeps decoded placeholder textures alive and avoids decoding the same hash twice
+	UPROPERTY(Transient)
+	TMap<FString, UTexture2D*> PlaceholderTextureCache;
 
 	// Deep link parameters storage
 	FString PendingDeepLinkShowroomId;
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Interfaces/IHttpRequest.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HttpResultCallback.h"
+#include "HttpRouteHandle.h"
+
+#include "RV_TrailerStreamer.generated.h"
+
+USTRUCT(BlueprintType)
+struct FRV_TrailerStreamMetrics
+{
+	GENERATED_BODY()
+
+	// Bytes downloaded over the network during this streaming session
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	int64 bytesFetched = 0;
+
+	// Bytes already on disk from an earlier session when streaming started
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	int64 bytesFromCache = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	int32 rangeRequests = 0;
+
+	// Seconds from StartStreaming until the first chunk is on disk; -1 until then. Download latency, not time to first frame.
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	float timeToFirstChunkSeconds = -1.f;
+
+	// Seconds from StartStreaming until OnReadyToPlay, i.e. PlaybackStartBytes were buffered; -1 until then. Byte threshold, not a frame.
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	float timeToReadySeconds = -1.f;
+
+	// Seconds from StartStreaming until the media player passed to TrackFirstFrame presented its first frame; -1 until then
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	float timeToFirstFrameSeconds = -1.f;
+
+	// Seconds from StartStreaming until the whole file is cached and OnComplete fires; -1 until complete
+	UPROPERTY(BlueprintReadOnly, Category="Readyverse|Trailer")
+	float timeToCompleteSeconds = -1.f;
+};
+
+class UMediaPlayer;
+class FHttpServerRequest;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRV_OnTrailerReadyToPlay, const FString&, PlaybackUrl);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRV_OnTrailerProgress, int64, BufferedBytes, int64, TotalBytes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRV_OnTrailerComplete, const FString&, LocalFilePath);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRV_OnTrailerFailed, const FString&, Error);
+
+// Asks the owner for a freshly signed SourceUrl; OnRefreshed receives the new URL, or an empty string if none is available
+DECLARE_DELEGATE_OneParam(FRV_RefreshTrailerUrl, TFunction<void(const FString&)> /*OnRefreshed*/);
+
+/**
+ * Streams a trailer into a resumable on-disk cache using HTTP Range requests and plays it while it downloads.
+ * Chunks are appended sequentially to Saved/RV_Showrooms/Trailers so a player who leaves and returns resumes
+ * where they left off. The cache file is served to media players through a loopback Range endpoint that reports
+ * the final size up front and holds reads of bytes that have not arrived yet, so playback can start once
+ * PlaybackStartBytes are buffered (trailers must be encoded "faststart", with the moov atom first).
+ */
+UCLASS(BlueprintType)
+class URV_TrailerStreamer : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer")
+	FString SourceUrl;
+
+	// Size reported by the server (bundle media sizeBytes); 0 if unknown. A cached file of a different size is discarded.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer")
+	int64 ExpectedSizeBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer", meta=(ClampMin="65536"))
+	int32 ChunkSizeBytes = 1024 * 1024;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer", meta=(ClampMin="0"))
+	int32 MaxRetriesPerChunk = 3;
+
+	// Bytes buffered before OnReadyToPlay fires; should cover the moov atom and the first GOP
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer", meta=(ClampMin="0"))
+	int32 PlaybackStartBytes = 2 * 1024 * 1024;
+
+	// Port of the playback endpoint served by the HTTPServer module; set [HTTPServer.Listeners] DefaultBindAddress=127.0.0.1 to keep it local.
+	// 0 disables progressive playback: OnReadyToPlay then fires with the local file path once the download completes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer", meta=(ClampMin="0", ClampMax="65535"))
+	int32 LoopbackPort = 48788;
+
+	// Budget for the whole trailer cache directory; least recently used trailers are evicted when a download starts. 0 disables eviction.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Readyverse|Trailer", meta=(ClampMin="0"))
+	int64 MaxCacheSizeBytes = 512LL * 1024 * 1024;
+
+	// Enough is buffered to start playback; open PlaybackUrl in a media player (e.g. UMediaPlayer::OpenUrl)
+	UPROPERTY(BlueprintAssignable, Category="Readyverse|Trailer")
+	FRV_OnTrailerReadyToPlay OnReadyToPlay;
+
+	UPROPERTY(BlueprintAssignable, Category="Readyverse|Trailer")
+	FRV_OnTrailerProgress OnProgress;
+
+	// The whole trailer is on disk
+	UPROPERTY(BlueprintAssignable, Category="Readyverse|Trailer")
+	FRV_OnTrailerComplete OnComplete;
+
+	UPROPERTY(BlueprintAssignable, Category="Readyverse|Trailer")
+	FRV_OnTrailerFailed OnFailed;
+
+	// Called once per failing chunk when the server rejects SourceUrl with a 4xx (e.g. an expired signature).
+	// Streaming resumes from the buffered offset with the new URL; if unbound, a 4xx fails the download.
+	FRV_RefreshTrailerUrl RefreshUrl;
+
+	// Starts or resumes streaming SourceUrl into the disk cache
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Trailer")
+	void StartStreaming();
+
+	// Cancels the in-flight chunk and keeps the partial file so the next StartStreaming resumes. Call when the player leaves the booth;
+	// bDiscardPartial drops the partial file instead. Cache size is bounded by MaxCacheSizeBytes, not by stopping.
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Trailer")
+	void StopStreaming(bool bDiscardPartial = false);
+
+	// Deletes the cached file for SourceUrl so the next StartStreaming downloads from scratch.
+	// Returns false while streaming or if another live streamer owns the file.
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Trailer")
+	bool ClearCachedFile();
+
+	UFUNCTION(BlueprintPure, Category="Readyverse|Trailer")
+	bool IsStreaming() const { return bStreaming; }
+
+	UFUNCTION(BlueprintPure, Category="Readyverse|Trailer")
+	bool IsComplete() const { return TotalBytes >= 0 && BufferedBytes >= TotalBytes; }
+
+	UFUNCTION(BlueprintPure, Category="Readyverse|Trailer")
+	FString GetLocalFilePath() const { return LocalFilePath; }
+
+	// Loopback URL while the playback endpoint is bound, otherwise the local file path
+	UFUNCTION(BlueprintPure, Category="Readyverse|Trailer")
+	FString GetPlaybackUrl() const;
+
+	// Records timeToFirstFrameSeconds once Player is playing and its playback time has advanced past zero
+	UFUNCTION(BlueprintCallable, Category="Readyverse|Trailer")
+	void TrackFirstFrame(UMediaPlayer* Player);
+
+	UFUNCTION(BlueprintPure, Category="Readyverse|Trailer")
+	FRV_TrailerStreamMetrics GetMetrics() const { return Metrics; }
+
+	virtual void BeginDestroy() override;
+
+private:
+	void RequestNextChunk();
+	void HandleChunkResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded, int64 RequestedOffset);
+	bool AppendToCache(const TArray<uint8>& Data);
+	bool ResetCache();
+	void RetryOrFail(const FString& Error);
+	void RefreshSourceUrl(int32 Code);
+	void FinishStreaming();
+	void CheckReadyToPlay();
+	void BindPlaybackRoute();
+	void UnbindPlaybackRoute();
+	bool HandlePlaybackRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	void ServicePlaybackReads();
+	void Fail(const FString& Error);
+	void CloseFile();
+	void SaveCacheInfo() const;
+	void RevalidateCache();
+	void HandleRevalidateResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+	static FString GetResponseValidator(const FHttpResponsePtr& Response);
+	void ResolveCachePaths();
+	void SetPinnedFile(const FString& Path);
+	void EvictCache(int64 ReserveBytes) const;
+	static FString GetCacheDir();
+	// Fields missing from the header ("*") are returned as -1
+	static bool ParseContentRange(const FString& ContentRange, int64& OutStart, int64& OutEnd, int64& OutTotal);
+
+	FString LocalFilePath;
+	FString SizeFilePath;
+	// Strong ETag or Last-Modified of the cached version; sent as If-Range when resuming
+	FString Validator;
+	FString PinnedFilePath;
+	TUniquePtr<IFileHandle> FileHandle;
+	FHttpRequestPtr ActiveRequest;
+
+	// Media player reads waiting for bytes that have not been downloaded yet
+	struct FPlaybackRead
+	{
+		int64 Start = 0;
+		int64 End = -1;          // -1 for open-ended ranges
+		int64 SuffixLength = 0;  // "bytes=-N" requests, resolved once the total size is known
+		FHttpResultCallback OnComplete;
+	};
+	TArray<FPlaybackRead> PendingPlaybackReads;
+	FHttpRouteHandle PlaybackRoute;
+	FString PlaybackRoutePath;
+	int32 FirstFrameTrackId = 0;
+
+	int64 BufferedBytes = 0;
+	int64 TotalBytes = -1;
+	int32 RetryCount = 0;
+	int32 SessionId = 0;
+	bool bUrlRefreshed = false;
+	double StartTime = 0.0;
+	bool bStreaming = false;
+	bool bReadyBroadcast = false;
+
+	FRV_TrailerStreamMetrics Metrics;
+};
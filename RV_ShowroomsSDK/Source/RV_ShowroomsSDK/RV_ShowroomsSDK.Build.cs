@@ -12,12 +12,15 @@ public class RV_ShowroomsSDK : ModuleRules
 			"HTTP",
 			"Json",
 			"JsonUtilities",
-			"Engine"
+			"Engine",
+			"HTTPServer",
+			"MediaAssets"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]
 		{
-			"CoreUObject"
+			"CoreUObject",
+			"Media"
 		});
 	}
 }
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Local HTTP Range server for measuring URV_TrailerStreamer.
+
+Serves files from a directory with single-range (206/416) and If-Range support
+(ETag and Last-Modified come from the file's mtime and size, so touching or
+replacing a trailer invalidates resumed downloads), and optional
+per-request latency and bandwidth limits, so trailer metrics can be reproduced
+without Supabase storage.
+
+    python trailer-range-server.py --dir ./trailers --latency-ms 80 --kbps 8000
+    UnrealEditor-Cmd MyGame.uproject -run=RV_TrailerStream -Url=http://127.0.0.1:8787/trailer.mp4 -Cold -InterruptAt=4194304
+
+Each request is logged with the requested range and status to stdout.
+"""
+
+import argparse
+import os
+import re
+import sys
+import time
+from email.utils import formatdate, parsedate_to_datetime
+from http.server import SimpleHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import unquote, urlsplit
+
+RANGE_RE = re.compile(r"^bytes=(\d*)-(\d*)$")
+
+
+class RangeRequestHandler(SimpleHTTPRequestHandler):
+    latency_ms = 0
+    kbps = 0
+    ignore_range = False
+
+    def do_GET(self):
+        self._serve(send_body=True)
+
+    def do_HEAD(self):
+        self._serve(send_body=False)
+
+    def _serve(self, send_body):
+        if self.latency_ms > 0:
+            time.sleep(self.latency_ms / 1000.0)
+
+        # Query strings (signed URL tokens) do not change which file is served
+        path = self.translate_path(unquote(urlsplit(self.path).path))
+        if not os.path.isfile(path):
+            self.send_error(404, "File not found")
+            return
+
+        stat = os.stat(path)
+        size = stat.st_size
+        etag = f'"{stat.st_mtime_ns:x}-{size:x}"'
+        last_modified = formatdate(stat.st_mtime, usegmt=True)
+        start, end = 0, size - 1
+        status = 200
+
+        range_header = self.headers.get("Range")
+        if range_header and not self._if_range_matches(etag, stat.st_mtime):
+            # The client's copy is stale: RFC 9110 says to ignore Range and send the whole file
+            range_header = None
+        if range_header and not self.ignore_range:
+            match = RANGE_RE.match(range_header.strip())
+            if not match or (not match.group(1) and not match.group(2)):
+                self.send_error(400, "Malformed Range")
+                return
+            if match.group(1):
+                start = int(match.group(1))
+                end = min(int(match.group(2)), size - 1) if match.group(2) else size - 1
+            else:
+                start = max(size - int(match.group(2)), 0)
+            if start >= size or start > end:
+                self.send_response(416)
+                self.send_header("Content-Range", f"bytes */{size}")
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+            status = 206
+
+        length = end - start + 1
+        self.send_response(status)
+        self.send_header("Content-Type", self.guess_type(path))
+        self.send_header("Accept-Ranges", "bytes")
+        self.send_header("Content-Length", str(length))
+        self.send_header("ETag", etag)
+        self.send_header("Last-Modified", last_modified)
+        if status == 206:
+            self.send_header("Content-Range", f"bytes {start}-{end}/{size}")
+        self.end_headers()
+
+        if send_body:
+            self._send_file_range(path, start, length)
+
+    def _if_range_matches(self, etag, mtime):
+        if_range = self.headers.get("If-Range")
+        if not if_range:
+            return True
+        if_range = if_range.strip()
+        if if_range.startswith('"') or if_range.startswith("W/"):
+            return if_range == etag
+        try:
+            return int(parsedate_to_datetime(if_range).timestamp()) == int(mtime)
+        except (TypeError, ValueError):
+            return False
+
+    def _send_file_range(self, path, start, length):
+        block = 64 * 1024
+        bytes_per_second = self.kbps * 1000 / 8 if self.kbps > 0 else 0
+        with open(path, "rb") as f:
+            f.seek(start)
+            remaining = length
+            while remaining > 0:
+                data = f.read(min(block, remaining))
+                if not data:
+                    break
+                try:
+                    self.wfile.write(data)
+                except (BrokenPipeError, ConnectionResetError):
+                    return
+                remaining -= len(data)
+                if bytes_per_second:
+                    time.sleep(len(data) / bytes_per_second)
+
+    def log_message(self, format, *args):
+        sys.stdout.write("%s [%s] %s\n" % (self.log_date_time_string(), self.headers.get("Range", "-"), format % args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HTTP Range server for trailer streaming metrics")
+    parser.add_argument("--dir", default=".", help="directory to serve (default: current directory)")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8787)
+    parser.add_argument("--latency-ms", type=int, default=0, help="delay before each response")
+    parser.add_argument("--kbps", type=int, default=0, help="bandwidth cap per request in kilobits/s (0 = unlimited)")
+    parser.add_argument("--ignore-range", action="store_true", help="answer every request with 200 and the whole file")
+    args = parser.parse_args()
+
+    RangeRequestHandler.latency_ms = args.latency_ms
+    RangeRequestHandler.kbps = args.kbps
+    RangeRequestHandler.ignore_range = args.ignore_range
+
+    os.chdir(args.dir)
+    server = ThreadingHTTPServer((args.host, args.port), RangeRequestHandler)
+    print(f"Serving {os.getcwd()} on http://{args.host}:{args.port}/ (latency {args.latency_ms}ms, {args.kbps or 'unlimited'} kbps)")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -21,6 +21,8 @@ namespace ShowroomBackend.Constants
             public const string CoverArtKey = "cover_art_key";
             public const string TrailerKey = "trailer_key";
             public const string ScreenshotsKeys = "screenshots_keys";
+            public const string GameLogoPlaceholder = "game_logo_placeholder";
+            public const string CoverArtPlaceholder = "cover_art_placeholder";
         }
 
         // Project model property names (camelCase for C#)
@@ -45,6 +47,13 @@ namespace ShowroomBackend.Constants
                 { "trailer", DatabaseFields.TrailerKey },
                 { "screenshot", DatabaseFields.ScreenshotsKeys }
             };
+
+            // Image placeholders are stored next to the storage key of the primary images
+            public static readonly Dictionary<string, string> KeyFieldToPlaceholderField = new()
+            {
+                { DatabaseFields.GameLogoKey, DatabaseFields.GameLogoPlaceholder },
+                { DatabaseFields.CoverArtKey, DatabaseFields.CoverArtPlaceholder }
+            };
         }
     }
 }
@@ -16,11 +16,13 @@ namespace ShowroomBackend.Controllers
     {
         private readonly ISupabaseService _supabaseService;
         private readonly ILogger<ProjectsController> _logger;
+        private readonly ShowroomBundleCache _bundleCache;
 
-        public ProjectsController(ISupabaseService supabaseService, ILogger<ProjectsController> logger)
+        public ProjectsController(ISupabaseService supabaseService, ILogger<ProjectsController> logger, ShowroomBundleCache bundleCache)
         {
             _supabaseService = supabaseService;
             _logger = logger;
+            _bundleCache = bundleCache;
         }
 
         /// <summary>
@@ -150,6 +152,7 @@ namespace ShowroomBackend.Controllers
 
                 var updated = await _supabaseService.UpdateProjectFieldsAsync(id, fields);
                 if (updated == null) return StatusCode(500, new { error = "Failed to save step" });
+                _bundleCache.Invalidate(id);
 
                 // Debug logging
                 _logger.LogInformation("Project updated successfully. Updated project: {Project}", 
@@ -192,6 +195,7 @@ namespace ShowroomBackend.Controllers
 
                 var updated = await _supabaseService.UpdateProjectFieldsAsync(id, fields);
                 if (updated == null) return StatusCode(500, new { error = "Failed to complete onboarding" });
+                _bundleCache.Invalidate(id);
 
                 _logger.LogInformation("Onboarding completed and project {ProjectId} auto-published", id);
 
@@ -235,6 +239,7 @@ namespace ShowroomBackend.Controllers
 
                 var updated = await _supabaseService.UpdateProjectFieldsAsync(id, fields);
                 if (updated == null) return StatusCode(500, new { error = "Failed to publish project" });
+                _bundleCache.Invalidate(id);
 
                 _logger.LogInformation("Project {ProjectId} published by user {UserId}", id, userId);
 
@@ -272,6 +277,7 @@ namespace ShowroomBackend.Controllers
 
                 var updated = await _supabaseService.UpdateProjectFieldsAsync(id, fields);
                 if (updated == null) return StatusCode(500, new { error = "Failed to unpublish project" });
+                _bundleCache.Invalidate(id);
 
                 _logger.LogInformation("Project {ProjectId} unpublished by user {UserId}", id, userId);
 
@@ -463,6 +469,8 @@ namespace ShowroomBackend.Controllers
                     return StatusCode(500, new { error = "Failed to update project" });
                 }
 
+                _bundleCache.Invalidate(id);
+
                 return Ok(updatedProject);
             }
             catch (Exception ex)
@@ -489,6 +497,8 @@ namespace ShowroomBackend.Controllers
                     return NotFound(new { error = "Project not found" });
                 }
 
+                _bundleCache.Invalidate(id);
+
                 return Ok(new { message = "Project deleted successfully" });
             }
             catch (Exception ex)
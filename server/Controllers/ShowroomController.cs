@@ -1,5 +1,6 @@
 using Microsoft.AspNetCore.Mvc;
 using ShowroomBackend.Models;
+using ShowroomBackend.Models.DTOs;
 using ShowroomBackend.Services;
 
 namespace ShowroomBackend.Controllers
@@ -13,11 +14,15 @@ namespace ShowroomBackend.Controllers
     {
         private readonly ISupabaseService _supabaseService;
         private readonly ILogger<ShowroomController> _logger;
+        private readonly IConfiguration _configuration;
+        private readonly ShowroomBundleCache _bundleCache;
 
-        public ShowroomController(ISupabaseService supabaseService, ILogger<ShowroomController> logger)
+        public ShowroomController(ISupabaseService supabaseService, ILogger<ShowroomController> logger, IConfiguration configuration, ShowroomBundleCache bundleCache)
         {
             _supabaseService = supabaseService;
             _logger = logger;
+            _configuration = configuration;
+            _bundleCache = bundleCache;
         }
 
         /// <summary>
@@ -64,6 +69,50 @@ namespace ShowroomBackend.Controllers
             }
         }
 
+        /// <summary>
+        /// Get everything needed to open a showroom booth in one request:
+        /// game details, signed media URLs and media sizes/content types
+        /// </summary>
+        /// <param name="id">Game ID</param>
+        /// <returns>Showroom bundle or 404 if not found</returns>
+        [HttpGet("games/{id}/bundle")]
+        public async Task<IActionResult> GetPublishedGameBundle(Guid id)
+        {
+            try
+            {
+                var ttl = 3600;
+                if (int.TryParse(_configuration["ASSET_URL_TTL"], out var parsedTtl)) ttl = parsedTtl;
+
+                // Never serve a cached bundle whose signed URLs are close to expiring
+                var cacheSeconds = 120;
+                if (int.TryParse(_configuration["SHOWROOM_BUNDLE_CACHE_SECONDS"], out var parsedCache)) cacheSeconds = parsedCache;
+                cacheSeconds = Math.Min(cacheSeconds, ttl / 2);
+
+                if (cacheSeconds > 0 && _bundleCache.TryGet(id, out var cached) && cached != null)
+                {
+                    return Ok(cached);
+                }
+
+                var bundle = await _supabaseService.GetPublishedGameBundleAsync(id, ttl);
+                if (bundle == null)
+                {
+                    return NotFound(new { error = "Game not found" });
+                }
+
+                if (cacheSeconds > 0)
+                {
+                    _bundleCache.Set(id, bundle, TimeSpan.FromSeconds(cacheSeconds));
+                }
+
+                return Ok(bundle);
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Error getting published game bundle {Id}", id);
+                return StatusCode(500, new { error = "Failed to get game bundle" });
+            }
+        }
+
         /// <summary>
         /// Get games by genre for filtering
         /// </summary>
@@ -3,10 +3,13 @@ using Microsoft.AspNetCore.Authorization;
 using System.Security.Claims;
 using ShowroomBackend.Services;
 using ShowroomBackend.Models;
+using ShowroomBackend.Models.DTOs;
 using ShowroomBackend.Constants;
 using System.ComponentModel.DataAnnotations;
 using System.Text.Json;
 using SixLabors.ImageSharp;
+using SixLabors.ImageSharp.Formats;
+using SixLabors.ImageSharp.PixelFormats;
 
 namespace ShowroomBackend.Controllers
 {
@@ -18,12 +21,18 @@ namespace ShowroomBackend.Controllers
         private readonly ISupabaseService _supabaseService;
         private readonly ILogger<UploadsController> _logger;
         private readonly IConfiguration _configuration;
+        private readonly ShowroomBundleCache _bundleCache;
 
-        public UploadsController(ISupabaseService supabaseService, ILogger<UploadsController> logger, IConfiguration configuration)
+        // Upper bounds checked against the image header before decoding
+        private const int MaxImageSide = 8192;
+        private const long MaxImagePixels = 40_000_000;
+
+        public UploadsController(ISupabaseService supabaseService, ILogger<UploadsController> logger, IConfiguration configuration, ShowroomBundleCache bundleCache)
         {
             _supabaseService = supabaseService;
             _logger = logger;
             _configuration = configuration;
+            _bundleCache = bundleCache;
         }
 
         [HttpPost("{projectId}")]
@@ -60,26 +69,8 @@ namespace ShowroomBackend.Controllers
                     return BadRequest(new { error = "Invalid file type. Only PNG, JPEG images and MP4 videos are allowed (Unreal Engine compatible formats)." });
                 }
 
-                // Validate image dimensions if provided
-                if (request.Width.HasValue && request.Height.HasValue && request.File.ContentType.StartsWith("image/"))
-                {
-                    var expectedWidth = request.Width.Value;
-                    var expectedHeight = request.Height.Value;
-                    _logger.LogInformation("Validating image dimensions: expected {ExpectedWidth}x{ExpectedHeight} for asset kind {AssetKind}", 
-                        expectedWidth, expectedHeight, request.Kind);
-                    
-                    // Validate actual image dimensions
-                    var (actualWidth, actualHeight) = await GetImageDimensionsAsync(request.File);
-                    if (actualWidth != expectedWidth || actualHeight != expectedHeight)
-                    {
-                        return BadRequest(new { error = $"Image dimensions must be exactly {expectedWidth}x{expectedHeight}px. Your image is {actualWidth}x{actualHeight}px." });
-                    }
-                    
-                    _logger.LogInformation("Image dimension validation passed for {FileName}: {ActualWidth}x{ActualHeight}", 
-                        request.File.FileName, actualWidth, actualHeight);
-                }
-
                 // Validate file size: images 10MB, videos 100MB
+                var isImage = request.File.ContentType.StartsWith("image/");
                 var isVideo = request.File.ContentType.StartsWith("video/");
                 var maxBytes = isVideo ? 100L * 1024 * 1024 : 10L * 1024 * 1024;
                 if (request.File.Length > maxBytes)
@@ -87,15 +78,6 @@ namespace ShowroomBackend.Controllers
                     return BadRequest(new { error = isVideo ? "File too large. Maximum video size is 100MB." : "File too large. Maximum image size is 10MB." });
                 }
 
-                // Validate image dimensions when provided
-                if (request.Width.HasValue && request.Height.HasValue && request.File.ContentType.StartsWith("image/"))
-                {
-                    // For now, we trust the client-provided dimensions since we're not decoding the image server-side
-                    // This is acceptable since the client-side validation should catch most issues
-                    _logger.LogInformation("Image dimensions: {Width}x{Height} for asset kind: {Kind}", 
-                        request.Width.Value, request.Height.Value, request.Kind);
-                }
-
                 // Additional constraints for teaser video (duration/size)
                 if ((request.Kind?.Equals(AssetConstants.AssetTypes.Trailer, StringComparison.OrdinalIgnoreCase) ?? false) && request.File.ContentType == "video/mp4")
                 {
@@ -106,6 +88,45 @@ namespace ShowroomBackend.Controllers
                     }
                 }
 
+                // Read image dimensions from the header only, so a small file claiming huge
+                // dimensions is rejected before any pixels are allocated
+                ImageInfo? imageInfo = null;
+                if (isImage)
+                {
+                    imageInfo = await IdentifyImageAsync(request.File);
+                    if (imageInfo == null)
+                    {
+                        return BadRequest(new { error = "Could not read image. Please upload a valid PNG or JPEG file." });
+                    }
+                    if (imageInfo.Width > MaxImageSide || imageInfo.Height > MaxImageSide || (long)imageInfo.Width * imageInfo.Height > MaxImagePixels)
+                    {
+                        return BadRequest(new { error = $"Image is too large. Maximum size is {MaxImageSide}px per side and {MaxImagePixels / 1_000_000} megapixels." });
+                    }
+                }
+
+                // Validate image dimensions if provided
+                if (request.Width.HasValue && request.Height.HasValue && imageInfo != null)
+                {
+                    var expectedWidth = request.Width.Value;
+                    var expectedHeight = request.Height.Value;
+                    _logger.LogInformation("Validating image dimensions: expected {ExpectedWidth}x{ExpectedHeight} for asset kind {AssetKind}", 
+                        expectedWidth, expectedHeight, request.Kind);
+                    
+                    var (actualWidth, actualHeight) = (imageInfo.Width, imageInfo.Height);
+                    if (actualWidth != expectedWidth || actualHeight != expectedHeight)
+                    {
+                        return BadRequest(new { error = $"Image dimensions must be exactly {expectedWidth}x{expectedHeight}px. Your image is {actualWidth}x{actualHeight}px." });
+                    }
+                    
+                    _logger.LogInformation("Image dimension validation passed for {FileName}: {ActualWidth}x{ActualHeight}", 
+                        request.File.FileName, actualWidth, actualHeight);
+                }
+
+                // Precompute blurhash and palette so clients can render a placeholder before the image downloads
+                // (decoded only now, after every cheap check has passed)
+                using var decodedImage = isImage ? await LoadImageAsync(request.File) : null;
+                var placeholder = decodedImage != null ? ComputeImagePlaceholder(decodedImage, request.File.FileName) : null;
+
                 // Upload file to Supabase Storage (namespaced per project)
                 using var stream = request.File.OpenReadStream();
                 _logger.LogInformation("Uploading file {FileName} to projects/{ProjectId}/", request.File.FileName, projectId);
@@ -132,6 +153,9 @@ namespace ShowroomBackend.Controllers
                     DurationSeconds = request.DurationSeconds,
                     Width = request.Width,
                     Height = request.Height,
+                    BlurHash = placeholder?.BlurHash,
+                    DominantColor = placeholder?.DominantColor,
+                    AccentColor = placeholder?.AccentColor,
                     CreatedAt = DateTime.UtcNow
                 };
 
@@ -181,6 +205,15 @@ namespace ShowroomBackend.Controllers
                         // Handle single-value fields (logo, cover, trailer)
                         fields[databaseField] = fileKey;
                         _logger.LogInformation("✅ Setting {DatabaseField} to {FileKey} for project {ProjectId}", databaseField, fileKey, projectId);
+
+                        // Keep the placeholder in sync with the key so a stale blurhash is never served
+                        // (empty string rather than null, since null fields are skipped by the PATCH)
+                        if (AssetConstants.AssetKindMappings.KeyFieldToPlaceholderField.TryGetValue(databaseField, out string? placeholderField))
+                        {
+                            fields[placeholderField] = placeholder != null
+                                ? JsonSerializer.Serialize(placeholder, new JsonSerializerOptions { PropertyNamingPolicy = JsonNamingPolicy.CamelCase })
+                                : string.Empty;
+                        }
                     }
                 }
                 else
@@ -193,6 +226,7 @@ namespace ShowroomBackend.Controllers
                     { 
                         _logger.LogInformation("Updating project {ProjectId} with fields: {Fields}", projectId, string.Join(", ", fields.Select(kv => $"{kv.Key}={kv.Value}")));
                         await _supabaseService.UpdateProjectFieldsAsync(projectId, fields);
+                        _bundleCache.Invalidate(projectId);
                         _logger.LogInformation("Successfully updated project {ProjectId} with asset keys", projectId);
                     } 
                     catch (Exception ex)
@@ -224,6 +258,9 @@ namespace ShowroomBackend.Controllers
                     createdAsset.DurationSeconds,
                     createdAsset.Width,
                     createdAsset.Height,
+                    createdAsset.BlurHash,
+                    createdAsset.DominantColor,
+                    createdAsset.AccentColor,
                     createdAsset.CreatedAt,
                     signedUrl,
                     publicUrl = assetPublicUrl
@@ -364,6 +401,9 @@ namespace ShowroomBackend.Controllers
                         width = a.Width,
                         height = a.Height,
                         durationSeconds = a.DurationSeconds,
+                        blurHash = a.BlurHash,
+                        dominantColor = a.DominantColor,
+                        accentColor = a.AccentColor,
                         signedUrl = url
                     });
                 }
@@ -391,6 +431,8 @@ namespace ShowroomBackend.Controllers
                     return NotFound(new { error = "Asset not found" });
                 }
 
+                _bundleCache.Invalidate(projectId);
+
                 return Ok(new { message = "Asset deleted successfully" });
             }
             catch (Exception ex)
@@ -400,18 +442,53 @@ namespace ShowroomBackend.Controllers
             }
         }
 
-        private async Task<(int width, int height)> GetImageDimensionsAsync(IFormFile file)
+        private async Task<ImageInfo?> IdentifyImageAsync(IFormFile file)
+        {
+            try
+            {
+                using var stream = file.OpenReadStream();
+                return await Image.IdentifyAsync(stream);
+            }
+            catch (Exception ex)
+            {
+                _logger.LogWarning(ex, "Failed to identify image {FileName}", file.FileName);
+                return null;
+            }
+        }
+
+        private async Task<Image<Rgba32>?> LoadImageAsync(IFormFile file)
         {
             try
             {
+                // Placeholders only need a thumbnail; decoders that support it (JPEG) scale while decoding
+                var options = new DecoderOptions
+                {
+                    TargetSize = new Size(ImagePlaceholderEncoder.SampleSize, ImagePlaceholderEncoder.SampleSize)
+                };
                 using var stream = file.OpenReadStream();
-                using var image = await Image.LoadAsync(stream);
-                return (image.Width, image.Height);
+                return await Image.LoadAsync<Rgba32>(options, stream);
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Failed to decode image {FileName}", file.FileName);
+                return null;
+            }
+        }
+
+        private ImagePlaceholderDto? ComputeImagePlaceholder(Image<Rgba32> image, string fileName)
+        {
+            try
+            {
+                var placeholder = ImagePlaceholderEncoder.Compute(image);
+                _logger.LogInformation("Computed placeholder for {FileName}: BlurHash={BlurHash}, Dominant={DominantColor}, Accent={AccentColor}",
+                    fileName, placeholder.BlurHash, placeholder.DominantColor, placeholder.AccentColor);
+                return placeholder;
             }
             catch (Exception ex)
             {
-                _logger.LogError(ex, "Failed to get image dimensions for {FileName}", file.FileName);
-                throw new InvalidOperationException("Failed to read image dimensions", ex);
+                // Placeholders are a nice-to-have; never fail the upload because of them
+                _logger.LogWarning(ex, "Failed to compute image placeholder for {FileName}", fileName);
+                return null;
             }
         }
     }
@@ -32,6 +32,11 @@ namespace ShowroomBackend.Models
         
         public int? Height { get; set; }
         
+        // Image placeholders computed at upload time
+        public string? BlurHash { get; set; }
+        public string? DominantColor { get; set; } // Hex color code
+        public string? AccentColor { get; set; } // Hex color code
+        
         public DateTime CreatedAt { get; set; } = DateTime.UtcNow;
         
         [JsonIgnore]
@@ -0,0 +1,13 @@
+namespace ShowroomBackend.Models.DTOs
+{
+    /// <summary>
+    /// Compact preview of an image computed at upload time, so clients can
+    /// render something before the full image has downloaded
+    /// </summary>
+    public class ImagePlaceholderDto
+    {
+        public string? BlurHash { get; set; }
+        public string? DominantColor { get; set; } // Hex color code, e.g. #1A2B3C
+        public string? AccentColor { get; set; } // Hex color code, e.g. #FF8800
+    }
+}
@@ -0,0 +1,27 @@
+namespace ShowroomBackend.Models.DTOs
+{
+    /// <summary>
+    /// Everything a client needs to open a showroom booth in a single response
+    /// </summary>
+    public class ShowroomBundleDto
+    {
+        public ShowroomGameDto Game { get; set; } = new();
+        public List<ShowroomMediaDto> Media { get; set; } = new();
+        public DateTime GeneratedAt { get; set; } = DateTime.UtcNow;
+        public int UrlExpiresInSeconds { get; set; }
+    }
+
+    /// <summary>
+    /// A signed media URL together with the stored file metadata
+    /// </summary>
+    public class ShowroomMediaDto
+    {
+        public string Kind { get; set; } = string.Empty; // app_icon, hero_image, trailer, screenshot
+        public string Url { get; set; } = string.Empty;
+        public string? ContentType { get; set; }
+        public long? SizeBytes { get; set; }
+        public int? Width { get; set; }
+        public int? Height { get; set; }
+        public int? DurationSeconds { get; set; }
+    }
+}
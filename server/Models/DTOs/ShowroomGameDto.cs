@@ -26,6 +26,8 @@ namespace ShowroomBackend.Models.DTOs
         public string? CoverArtUrl { get; set; }
         public string? TrailerUrl { get; set; }
         public string[] ScreenshotUrls { get; set; } = Array.Empty<string>();
+        public ImagePlaceholderDto? GameLogoPlaceholder { get; set; }
+        public ImagePlaceholderDto? CoverArtPlaceholder { get; set; }
         
         // Game URLs
         public string? GameUrl { get; set; }
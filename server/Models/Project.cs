@@ -80,6 +80,8 @@ namespace ShowroomBackend.Models
         public string? CoverArtKey { get; set; }
         public string? TrailerKey { get; set; }
         public string? ScreenshotsKeys { get; set; } // JSON array of screenshot file keys
+        public string? GameLogoPlaceholder { get; set; } // JSON object: blurHash, dominantColor, accentColor
+        public string? CoverArtPlaceholder { get; set; } // JSON object: blurHash, dominantColor, accentColor
         
         // Optional Add-Ons
         public string? ShowroomInterest { get; set; } // Yes with assistance, Yes in-house, No
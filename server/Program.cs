@@ -92,6 +92,10 @@ builder.Services.AddHttpClient<SupabaseRestService>();
 builder.Services.AddScoped<SupabaseRestService>();
 builder.Services.AddScoped<ISupabaseService, SupabaseRestService>();
 
+// In-memory cache for public showroom bundles
+builder.Services.AddMemoryCache();
+builder.Services.AddSingleton<ShowroomBundleCache>();
+
 // Add health checks
 builder.Services.AddHealthChecks();
 
@@ -22,6 +22,7 @@ namespace ShowroomBackend.Services
         Task<bool> DeleteAssetAsync(Guid id);
         Task<string> UploadFileAsync(Stream fileStream, string fileName, string bucketName, string folder = "");
         Task<string> GetSignedUrlAsync(string bucketName, string fileKey, int expiresIn = 3600);
+        Task<Dictionary<string, string>> GetSignedUrlsAsync(string bucketName, IEnumerable<string> fileKeys, int expiresIn = 3600);
         Task<Organization?> GetUserOrganizationAsync(string userId);
         Task<Organization?> CreateOrUpdateUserOrganizationAsync(string userId, Organization organization);
         Task<Organization?> UpdateOrganizationAsync(Organization organization);
@@ -29,6 +30,7 @@ namespace ShowroomBackend.Services
         // Showroom methods (public, no authentication required)
         Task<List<ShowroomGameDto>> GetPublishedGamesAsync();
         Task<ShowroomGameDto?> GetPublishedGameByIdAsync(Guid id);
+        Task<ShowroomBundleDto?> GetPublishedGameBundleAsync(Guid id, int expiresIn = 3600);
         Task<List<ShowroomGameDto>> GetPublishedGamesByGenreAsync(string genre);
         Task<List<ShowroomGameDto>> GetPublishedGamesByTrackAsync(string track);
         Task<List<ShowroomGameDto>> SearchPublishedGamesAsync(string query);
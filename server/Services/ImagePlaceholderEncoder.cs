@@ -0,0 +1,250 @@
+using System.Text;
+using ShowroomBackend.Models.DTOs;
+using SixLabors.ImageSharp;
+using SixLabors.ImageSharp.PixelFormats;
+using SixLabors.ImageSharp.Processing;
+
+namespace ShowroomBackend.Services
+{
+    /// <summary>
+    /// Computes blurhash strings and a dominant/accent palette for uploaded images
+    /// </summary>
+    public static class ImagePlaceholderEncoder
+    {
+        // Images are downscaled before encoding; a blurhash only keeps a handful of
+        // low-frequency components so the source resolution does not matter
+        public const int SampleSize = 64;
+        private const int MaxComponents = 4;
+        private const int MinComponents = 3;
+
+        // Pixels with less alpha than this are ignored (transparent logo backgrounds)
+        private const byte MinAlpha = 128;
+
+        // Accent must be at least this far (RGB distance) from the dominant color
+        private const double MinAccentDistance = 48.0;
+
+        // Backdrop for fully transparent images, which have no dominant color
+        private static readonly Rgba32 NeutralBackground = new(128, 128, 128, 255);
+
+        private const string Base83Chars =
+            "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~";
+
+        public static ImagePlaceholderDto Compute(Image<Rgba32> source)
+        {
+            using var sample = source.Clone(ctx => ctx.Resize(new ResizeOptions
+            {
+                Size = new Size(SampleSize, SampleSize),
+                Mode = ResizeMode.Max
+            }));
+
+            var pixels = new Rgba32[sample.Width * sample.Height];
+            sample.CopyPixelDataTo(pixels);
+
+            // Keep more horizontal detail for landscape images and vice versa
+            var componentsX = sample.Width >= sample.Height ? MaxComponents : MinComponents;
+            var componentsY = sample.Width >= sample.Height ? MinComponents : MaxComponents;
+
+            var (dominant, accent) = ComputePalette(pixels);
+
+            // Blurhash has no alpha and clients render it opaque; flatten onto the dominant color
+            // so transparent logo backgrounds don't decode as a dark block
+            var background = dominant.HasValue
+                ? new Rgba32((byte)dominant.Value.r, (byte)dominant.Value.g, (byte)dominant.Value.b, 255)
+                : NeutralBackground;
+            FlattenAlpha(pixels, background);
+
+            return new ImagePlaceholderDto
+            {
+                BlurHash = EncodeBlurHash(pixels, sample.Width, sample.Height, componentsX, componentsY),
+                DominantColor = dominant.HasValue ? ToHex(dominant.Value) : null,
+                AccentColor = accent.HasValue ? ToHex(accent.Value) : null
+            };
+        }
+
+        private static void FlattenAlpha(Rgba32[] pixels, Rgba32 background)
+        {
+            for (int i = 0; i < pixels.Length; i++)
+            {
+                var px = pixels[i];
+                if (px.A == 255) continue;
+                int a = px.A;
+                pixels[i] = new Rgba32(
+                    (byte)((px.R * a + background.R * (255 - a) + 127) / 255),
+                    (byte)((px.G * a + background.G * (255 - a) + 127) / 255),
+                    (byte)((px.B * a + background.B * (255 - a) + 127) / 255),
+                    255);
+            }
+        }
+
+        private static string EncodeBlurHash(Rgba32[] pixels, int width, int height, int componentsX, int componentsY)
+        {
+            // Pre-convert to linear space once; each component iterates every pixel
+            var linear = new (double r, double g, double b)[pixels.Length];
+            for (int i = 0; i < pixels.Length; i++)
+            {
+                linear[i] = (SrgbToLinear(pixels[i].R), SrgbToLinear(pixels[i].G), SrgbToLinear(pixels[i].B));
+            }
+
+            var factors = new (double r, double g, double b)[componentsX * componentsY];
+            for (int j = 0; j < componentsY; j++)
+            {
+                for (int i = 0; i < componentsX; i++)
+                {
+                    double normalisation = (i == 0 && j == 0) ? 1.0 : 2.0;
+                    double r = 0, g = 0, b = 0;
+                    for (int y = 0; y < height; y++)
+                    {
+                        double basisY = Math.Cos(Math.PI * j * y / height);
+                        for (int x = 0; x < width; x++)
+                        {
+                            double basis = basisY * Math.Cos(Math.PI * i * x / width);
+                            var px = linear[y * width + x];
+                            r += basis * px.r;
+                            g += basis * px.g;
+                            b += basis * px.b;
+                        }
+                    }
+                    double scale = normalisation / (width * height);
+                    factors[j * componentsX + i] = (r * scale, g * scale, b * scale);
+                }
+            }
+
+            var hash = new StringBuilder();
+            EncodeBase83((componentsX - 1) + (componentsY - 1) * 9, 1, hash);
+
+            double maximumValue = 1.0;
+            if (factors.Length > 1)
+            {
+                double actualMaximum = 0;
+                for (int k = 1; k < factors.Length; k++)
+                {
+                    actualMaximum = Math.Max(actualMaximum, Math.Max(Math.Abs(factors[k].r), Math.Max(Math.Abs(factors[k].g), Math.Abs(factors[k].b))));
+                }
+                int quantisedMaximum = (int)Math.Clamp(Math.Floor(actualMaximum * 166 - 0.5), 0, 82);
+                maximumValue = (quantisedMaximum + 1) / 166.0;
+                EncodeBase83(quantisedMaximum, 1, hash);
+            }
+            else
+            {
+                EncodeBase83(0, 1, hash);
+            }
+
+            var dc = factors[0];
+            EncodeBase83((LinearToSrgb(dc.r) << 16) + (LinearToSrgb(dc.g) << 8) + LinearToSrgb(dc.b), 4, hash);
+
+            for (int k = 1; k < factors.Length; k++)
+            {
+                int quantR = QuantiseAc(factors[k].r, maximumValue);
+                int quantG = QuantiseAc(factors[k].g, maximumValue);
+                int quantB = QuantiseAc(factors[k].b, maximumValue);
+                EncodeBase83(quantR * 19 * 19 + quantG * 19 + quantB, 2, hash);
+            }
+
+            return hash.ToString();
+        }
+
+        private static ((int r, int g, int b)? dominant, (int r, int g, int b)? accent) ComputePalette(Rgba32[] pixels)
+        {
+            // Bucket colors at 4 bits per channel and average within each bucket
+            var counts = new int[4096];
+            var sums = new (long r, long g, long b)[4096];
+            int opaque = 0;
+
+            foreach (var px in pixels)
+            {
+                if (px.A < MinAlpha) continue;
+                int bucket = ((px.R >> 4) << 8) | ((px.G >> 4) << 4) | (px.B >> 4);
+                counts[bucket]++;
+                sums[bucket].r += px.R;
+                sums[bucket].g += px.G;
+                sums[bucket].b += px.B;
+                opaque++;
+            }
+
+            if (opaque == 0)
+            {
+                return (null, null);
+            }
+
+            int dominantBucket = 0;
+            for (int k = 1; k < counts.Length; k++)
+            {
+                if (counts[k] > counts[dominantBucket]) dominantBucket = k;
+            }
+            var dominant = BucketAverage(sums[dominantBucket], counts[dominantBucket]);
+
+            // Accent: the most saturated color that covers a meaningful share of the image
+            // and is visibly different from the dominant one
+            int minCount = Math.Max(1, opaque / 100);
+            (int r, int g, int b)? accent = null;
+            double bestScore = 0;
+            for (int k = 0; k < counts.Length; k++)
+            {
+                if (counts[k] < minCount || k == dominantBucket) continue;
+                var candidate = BucketAverage(sums[k], counts[k]);
+                if (ColorDistance(candidate, dominant) < MinAccentDistance) continue;
+
+                int max = Math.Max(candidate.r, Math.Max(candidate.g, candidate.b));
+                int min = Math.Min(candidate.r, Math.Min(candidate.g, candidate.b));
+                double saturation = max == 0 ? 0 : (max - min) / (double)max;
+                double score = saturation * Math.Sqrt(counts[k]);
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    accent = candidate;
+                }
+            }
+
+            return (dominant, accent ?? dominant);
+        }
+
+        private static (int r, int g, int b) BucketAverage((long r, long g, long b) sum, int count)
+        {
+            return ((int)(sum.r / count), (int)(sum.g / count), (int)(sum.b / count));
+        }
+
+        private static double ColorDistance((int r, int g, int b) a, (int r, int g, int b) b)
+        {
+            int dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+            return Math.Sqrt(dr * dr + dg * dg + db * db);
+        }
+
+        private static string ToHex((int r, int g, int b) color)
+        {
+            return $"#{color.r:X2}{color.g:X2}{color.b:X2}";
+        }
+
+        private static int QuantiseAc(double value, double maximumValue)
+        {
+            return (int)Math.Clamp(Math.Floor(SignPow(value / maximumValue, 0.5) * 9 + 9.5), 0, 18);
+        }
+
+        private static double SignPow(double value, double exp)
+        {
+            return Math.CopySign(Math.Pow(Math.Abs(value), exp), value);
+        }
+
+        private static double SrgbToLinear(byte value)
+        {
+            double v = value / 255.0;
+            return v <= 0.04045 ? v / 12.92 : Math.Pow((v + 0.055) / 1.055, 2.4);
+        }
+
+        private static int LinearToSrgb(double value)
+        {
+            double v = Math.Clamp(value, 0, 1);
+            return v <= 0.0031308
+                ? (int)(v * 12.92 * 255 + 0.5)
+                : (int)((1.055 * Math.Pow(v, 1 / 2.4) - 0.055) * 255 + 0.5);
+        }
+
+        private static void EncodeBase83(int value, int length, StringBuilder output)
+        {
+            for (int i = 1; i <= length; i++)
+            {
+                int digit = (value / (int)Math.Pow(83, length - i)) % 83;
+                output.Append(Base83Chars[digit]);
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+using Microsoft.Extensions.Caching.Memory;
+using ShowroomBackend.Models.DTOs;
+
+namespace ShowroomBackend.Services
+{
+    /// <summary>
+    /// Owns the in-memory cache of showroom bundles so every writer that changes
+    /// a project's published state or media can evict the same key
+    /// </summary>
+    public class ShowroomBundleCache
+    {
+        private readonly IMemoryCache _cache;
+
+        public ShowroomBundleCache(IMemoryCache cache)
+        {
+            _cache = cache;
+        }
+
+        private static string GetKey(Guid projectId) => $"showroom-bundle:{projectId}";
+
+        /// <summary>
+        /// Returns a copy of the cached bundle with UrlExpiresInSeconds reduced by the time it spent in the cache
+        /// </summary>
+        public bool TryGet(Guid projectId, out ShowroomBundleDto? bundle)
+        {
+            bundle = null;
+            if (!_cache.TryGetValue(GetKey(projectId), out ShowroomBundleDto? cached) || cached == null)
+            {
+                return false;
+            }
+
+            var age = (int)Math.Ceiling((DateTime.UtcNow - cached.GeneratedAt).TotalSeconds);
+            bundle = new ShowroomBundleDto
+            {
+                Game = cached.Game,
+                Media = cached.Media,
+                GeneratedAt = cached.GeneratedAt,
+                UrlExpiresInSeconds = Math.Max(0, cached.UrlExpiresInSeconds - Math.Max(0, age))
+            };
+            return true;
+        }
+
+        public void Set(Guid projectId, ShowroomBundleDto bundle, TimeSpan duration)
+        {
+            _cache.Set(GetKey(projectId), bundle, duration);
+        }
+
+        public void Invalidate(Guid projectId)
+        {
+            _cache.Remove(GetKey(projectId));
+        }
+    }
+}
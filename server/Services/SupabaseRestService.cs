@@ -51,6 +51,8 @@ namespace ShowroomBackend.Services
             AssetConstants.DatabaseFields.CoverArtKey,
             AssetConstants.DatabaseFields.TrailerKey,
             AssetConstants.DatabaseFields.ScreenshotsKeys,
+            AssetConstants.DatabaseFields.GameLogoPlaceholder,
+            AssetConstants.DatabaseFields.CoverArtPlaceholder,
             // Optional add-ons and system
             "showroom_interest","showroom_tier","showroom_lighting_color","wants_surreal_estate","submission_status","intake_submitted_at","technical_integration_submitted_at",
             "compliance_review_submitted_at","game_submission_submitted_at","approved_at","rejection_reason","readyverse_tech_team_notes",
@@ -463,6 +465,7 @@ namespace ShowroomBackend.Services
                     var content = await response.Content.ReadAsStringAsync();
                     var assets = JsonSerializer.Deserialize<Asset[]>(content, new JsonSerializerOptions
                     {
+                        PropertyNamingPolicy = JsonNamingPolicy.SnakeCaseLower,
                         PropertyNameCaseInsensitive = true
                     });
                     
@@ -495,6 +498,9 @@ namespace ShowroomBackend.Services
                     { "duration_seconds", asset.DurationSeconds },
                     { "width", asset.Width },
                     { "height", asset.Height },
+                    { "blur_hash", asset.BlurHash },
+                    { "dominant_color", asset.DominantColor },
+                    { "accent_color", asset.AccentColor },
                     { "created_at", asset.CreatedAt }
                 };
 
@@ -636,7 +642,7 @@ namespace ShowroomBackend.Services
                     
                     if (result.TryGetProperty("signedURL", out var signedUrl))
                     {
-                        return signedUrl.GetString() ?? "";
+                        return ToAbsoluteStorageUrl(signedUrl.GetString());
                     }
                 }
 
@@ -659,6 +665,66 @@ namespace ShowroomBackend.Services
             }
         }
 
+        public async Task<Dictionary<string, string>> GetSignedUrlsAsync(string bucketName, IEnumerable<string> fileKeys, int expiresIn = 3600)
+        {
+            var keys = fileKeys.Where(k => !string.IsNullOrEmpty(k)).Distinct().ToList();
+            var result = new Dictionary<string, string>(StringComparer.Ordinal);
+            if (keys.Count == 0)
+            {
+                return result;
+            }
+
+            try
+            {
+                // Sign all keys in one storage request instead of one request per key
+                var payload = JsonSerializer.Serialize(new { expiresIn, paths = keys });
+                var content = new StringContent(payload, Encoding.UTF8, "application/json");
+                var response = await _httpClient.PostAsync($"{_supabaseUrl}/storage/v1/object/sign/{bucketName}", content);
+
+                if (response.IsSuccessStatusCode)
+                {
+                    var responseContent = await response.Content.ReadAsStringAsync();
+                    var entries = JsonSerializer.Deserialize<JsonElement>(responseContent);
+                    if (entries.ValueKind == JsonValueKind.Array)
+                    {
+                        foreach (var entry in entries.EnumerateArray())
+                        {
+                            if (entry.TryGetProperty("path", out var path) &&
+                                entry.TryGetProperty("signedURL", out var signedUrl) &&
+                                signedUrl.ValueKind == JsonValueKind.String)
+                            {
+                                result[path.GetString() ?? ""] = ToAbsoluteStorageUrl(signedUrl.GetString());
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    _logger.LogWarning("Batch signed URL request failed with {Status} for {Count} keys", response.StatusCode, keys.Count);
+                }
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Failed to get signed URLs for {Count} keys", keys.Count);
+            }
+
+            // Fall back to public URLs for anything the batch did not sign, as GetSignedUrlAsync does
+            foreach (var key in keys.Where(k => !result.ContainsKey(k)))
+            {
+                var encodedKey = string.Join("/", key.Split('/', StringSplitOptions.RemoveEmptyEntries).Select(Uri.EscapeDataString));
+                result[key] = $"{_supabaseUrl}/storage/v1/object/public/{bucketName}/{encodedKey}";
+            }
+
+            return result;
+        }
+
+        private string ToAbsoluteStorageUrl(string? signedUrl)
+        {
+            // Storage returns signed URLs relative to /storage/v1
+            if (string.IsNullOrEmpty(signedUrl)) return "";
+            return signedUrl.StartsWith("/") ? $"{_supabaseUrl}/storage/v1{signedUrl}" : signedUrl;
+        }
+
         public async Task<Organization?> GetUserOrganizationAsync(string userId)
         {
             try
@@ -874,54 +940,110 @@ namespace ShowroomBackend.Services
         {
             try
             {
-                // Use the same filter as GetPublishedGamesAsync for consistency
-                var queryUrl = $"projects?id=eq.{id.ToString()}&is_published=eq.true&select=*";
-                _logger.LogInformation("Querying for published game with ID: {GameId}, URL: {QueryUrl}", id, queryUrl);
-                
-                var response = await _httpClient.GetAsync(queryUrl);
-                
-                _logger.LogInformation("Response status: {StatusCode}", response.StatusCode);
-                
-                if (response.IsSuccessStatusCode)
+                var project = await GetPublishedProjectByIdAsync(id);
+                return project != null ? await MapToShowroomGameDtoAsync(project) : null;
+            }
+            catch (Exception ex)
+            {
+                _logger.LogError(ex, "Failed to get published game {GameId}", id);
+                throw;
+            }
+        }
+
+        public async Task<ShowroomBundleDto?> GetPublishedGameBundleAsync(Guid id, int expiresIn = 3600)
+        {
+            try
+            {
+                // Project row and asset metadata are independent; fetch them concurrently
+                var projectTask = GetPublishedProjectByIdAsync(id);
+                var assetsTask = GetProjectAssetsAsync(id);
+                await Task.WhenAll(projectTask, assetsTask);
+
+                var project = projectTask.Result;
+                if (project == null)
                 {
-                    var content = await response.Content.ReadAsStringAsync();
-                    _logger.LogInformation("Response content: {Content}", content);
-                    
-                    var projects = JsonSerializer.Deserialize<Project[]>(content, new JsonSerializerOptions
-                    {
-                        PropertyNamingPolicy = JsonNamingPolicy.SnakeCaseLower,
-                        PropertyNameCaseInsensitive = true
-                    });
+                    return null;
+                }
 
-                    _logger.LogInformation("Deserialized projects count: {Count}", projects?.Length ?? 0);
+                var signedUrls = await GetSignedUrlsAsync("showrooms", GetProjectMediaKeys(project), expiresIn);
+                var game = MapToShowroomGameDto(project, signedUrls);
 
-                    var project = projects?.FirstOrDefault();
-                    if (project != null)
-                    {
-                        _logger.LogInformation("Found project: {ProjectId}, Name: {ProjectName}", project.Id, project.Name);
-                        return await MapToShowroomGameDtoAsync(project);
-                    }
-                    else
+                // Newest asset row wins when the same storage key was uploaded more than once
+                var assetsByKey = new Dictionary<string, Asset>(StringComparer.Ordinal);
+                foreach (var asset in assetsTask.Result.OrderByDescending(a => a.CreatedAt))
+                {
+                    if (!string.IsNullOrEmpty(asset.FileKey)) assetsByKey.TryAdd(asset.FileKey, asset);
+                }
+
+                var media = new List<ShowroomMediaDto>();
+                void AddMedia(string kind, string? key)
+                {
+                    if (string.IsNullOrEmpty(key) || !signedUrls.TryGetValue(key, out var url)) return;
+                    assetsByKey.TryGetValue(key, out var asset);
+                    media.Add(new ShowroomMediaDto
                     {
-                        _logger.LogWarning("No project found with ID: {GameId}", id);
-                        return null;
-                    }
+                        Kind = kind,
+                        Url = url,
+                        ContentType = asset?.MimeType ?? GetContentType(key),
+                        SizeBytes = asset?.FileSize,
+                        Width = asset?.Width,
+                        Height = asset?.Height,
+                        DurationSeconds = asset?.DurationSeconds
+                    });
                 }
-                else
+
+                AddMedia(AssetConstants.AssetTypes.AppIcon, project.GameLogoKey);
+                AddMedia(AssetConstants.AssetTypes.HeroImage, project.CoverArtKey);
+                AddMedia(AssetConstants.AssetTypes.Trailer, project.TrailerKey);
+                foreach (var key in ParseScreenshotKeys(project.ScreenshotsKeys))
                 {
-                    var errorContent = await response.Content.ReadAsStringAsync();
-                    _logger.LogError("Failed to get project. Status: {StatusCode}, Content: {Content}", response.StatusCode, errorContent);
+                    AddMedia(AssetConstants.AssetTypes.Screenshots, key);
                 }
 
-                return null;
+                return new ShowroomBundleDto
+                {
+                    Game = game,
+                    Media = media,
+                    GeneratedAt = DateTime.UtcNow,
+                    UrlExpiresInSeconds = expiresIn
+                };
             }
             catch (Exception ex)
             {
-                _logger.LogError(ex, "Failed to get published game {GameId}", id);
+                _logger.LogError(ex, "Failed to get published game bundle {GameId}", id);
                 throw;
             }
         }
 
+        private async Task<Project?> GetPublishedProjectByIdAsync(Guid id)
+        {
+            // Use the same filter as GetPublishedGamesAsync for consistency
+            var response = await _httpClient.GetAsync($"projects?id=eq.{id}&is_published=eq.true&select=*");
+
+            if (response.IsSuccessStatusCode)
+            {
+                var content = await response.Content.ReadAsStringAsync();
+                _logger.LogDebug("Published project {GameId} response: {Content}", id, content);
+
+                var projects = JsonSerializer.Deserialize<Project[]>(content, new JsonSerializerOptions
+                {
+                    PropertyNamingPolicy = JsonNamingPolicy.SnakeCaseLower,
+                    PropertyNameCaseInsensitive = true
+                });
+
+                var project = projects?.FirstOrDefault();
+                if (project == null)
+                {
+                    _logger.LogWarning("No published project found with ID: {GameId}", id);
+                }
+                return project;
+            }
+
+            var errorContent = await response.Content.ReadAsStringAsync();
+            _logger.LogError("Failed to get project. Status: {StatusCode}, Content: {Content}", response.StatusCode, errorContent);
+            return null;
+        }
+
         public async Task<List<ShowroomGameDto>> GetPublishedGamesByGenreAsync(string genre)
         {
             try
@@ -1067,56 +1189,67 @@ namespace ShowroomBackend.Services
             }
         }
 
-        private async Task<string[]> GetScreenshotUrlsFromProjectKey(string? screenshotsKey)
+        private string[] ParseScreenshotKeys(string? screenshotsKey)
         {
+            if (string.IsNullOrEmpty(screenshotsKey))
+            {
+                return new string[0];
+            }
+
             try
             {
-                if (string.IsNullOrEmpty(screenshotsKey))
-                {
-                    _logger.LogInformation("No screenshots key provided");
-                    return new string[0];
-                }
+                var screenshotKeys = JsonSerializer.Deserialize<string[]>(screenshotsKey) ?? new string[0];
+                return screenshotKeys.Where(k => !string.IsNullOrEmpty(k)).ToArray();
+            }
+            catch (JsonException ex)
+            {
+                _logger.LogError(ex, "Failed to parse screenshot keys: {ScreenshotsKey}", screenshotsKey);
+                return new string[0];
+            }
+        }
 
-                var screenshotKeys = JsonSerializer.Deserialize<string[]>(screenshotsKey);
-                if (screenshotKeys == null || screenshotKeys.Length == 0)
-                {
-                    _logger.LogInformation("No screenshot keys found in JSON");
-                    return new string[0];
-                }
+        private IEnumerable<string> GetProjectMediaKeys(Project project)
+        {
+            var keys = new List<string>();
+            if (!string.IsNullOrEmpty(project.GameLogoKey)) keys.Add(project.GameLogoKey);
+            if (!string.IsNullOrEmpty(project.CoverArtKey)) keys.Add(project.CoverArtKey);
+            if (!string.IsNullOrEmpty(project.TrailerKey)) keys.Add(project.TrailerKey);
+            keys.AddRange(ParseScreenshotKeys(project.ScreenshotsKeys));
+            return keys;
+        }
 
-                _logger.LogInformation("Found {Count} screenshot keys in project", screenshotKeys.Length);
-                
-                var screenshotUrls = new List<string>();
-                
-                foreach (var key in screenshotKeys)
+        private ImagePlaceholderDto? ParseImagePlaceholder(string? placeholderJson)
+        {
+            if (string.IsNullOrEmpty(placeholderJson))
+            {
+                return null;
+            }
+
+            try
+            {
+                return JsonSerializer.Deserialize<ImagePlaceholderDto>(placeholderJson, new JsonSerializerOptions
                 {
-                    if (!string.IsNullOrEmpty(key))
-                    {
-                        var signedUrl = await GetSignedUrlAsync("showrooms", key, 3600);
-                        if (!string.IsNullOrEmpty(signedUrl))
-                        {
-                            screenshotUrls.Add(signedUrl);
-                            _logger.LogInformation("Generated signed URL for screenshot: {Url}", signedUrl);
-                        }
-                        else
-                        {
-                            _logger.LogWarning("Failed to generate signed URL for screenshot key: {Key}", key);
-                        }
-                    }
-                }
-                
-                _logger.LogInformation("Returning {Count} screenshot URLs", screenshotUrls.Count);
-                return screenshotUrls.ToArray();
+                    PropertyNameCaseInsensitive = true
+                });
             }
-            catch (Exception ex)
+            catch (JsonException ex)
             {
-                _logger.LogError(ex, "Failed to get screenshot URLs from project key: {ScreenshotsKey}", screenshotsKey);
-                return new string[0];
+                _logger.LogWarning("Failed to parse image placeholder: {Error}", ex.Message);
+                return null;
             }
         }
 
         private async Task<ShowroomGameDto> MapToShowroomGameDtoAsync(Project project)
         {
+            var signedUrls = await GetSignedUrlsAsync("showrooms", GetProjectMediaKeys(project), 3600);
+            return MapToShowroomGameDto(project, signedUrls);
+        }
+
+        private ShowroomGameDto MapToShowroomGameDto(Project project, Dictionary<string, string> signedUrls)
+        {
+            string? SignedUrlFor(string? key) =>
+                !string.IsNullOrEmpty(key) && signedUrls.TryGetValue(key, out var url) ? url : null;
+
             var targetPlatforms = new string[0];
             if (!string.IsNullOrEmpty(project.TargetPlatforms))
             {
@@ -1143,13 +1276,13 @@ namespace ShowroomBackend.Services
                 PublishingTrack = project.PublishingTrack,
                 BuildStatus = project.BuildStatus,
                 TargetPlatforms = targetPlatforms,
-                GameLogoUrl = !string.IsNullOrEmpty(project.GameLogoKey) ? 
-                    await GetSignedUrlAsync("showrooms", project.GameLogoKey, 3600) : null,
-                CoverArtUrl = !string.IsNullOrEmpty(project.CoverArtKey) ? 
-                    await GetSignedUrlAsync("showrooms", project.CoverArtKey, 3600) : null,
-                TrailerUrl = !string.IsNullOrEmpty(project.TrailerKey) ? 
-                    await GetSignedUrlAsync("showrooms", project.TrailerKey, 3600) : null,
-                ScreenshotUrls = await GetScreenshotUrlsFromProjectKey(project.ScreenshotsKeys),
+                GameLogoUrl = SignedUrlFor(project.GameLogoKey),
+                CoverArtUrl = SignedUrlFor(project.CoverArtKey),
+                TrailerUrl = SignedUrlFor(project.TrailerKey),
+                ScreenshotUrls = ParseScreenshotKeys(project.ScreenshotsKeys)
+                    .Select(SignedUrlFor).OfType<string>().ToArray(),
+                GameLogoPlaceholder = ParseImagePlaceholder(project.GameLogoPlaceholder),
+                CoverArtPlaceholder = ParseImagePlaceholder(project.CoverArtPlaceholder),
                 ShowroomTier = project.ShowroomTier,
                 ShowroomLightingColor = project.ShowroomLightingColor,
                 IsPublished = project.IsPublished,
@@ -57,6 +57,8 @@ CREATE TABLE IF NOT EXISTS projects (
     cover_art_key TEXT,
     trailer_key TEXT,
     screenshots_keys TEXT, -- JSON array of screenshot file keys
+    game_logo_placeholder TEXT, -- JSON object: blurHash, dominantColor, accentColor
+    cover_art_placeholder TEXT, -- JSON object: blurHash, dominantColor, accentColor
     
     -- Optional Add-Ons
     showroom_interest TEXT, -- Yes with assistance, Yes in-house, No
@@ -99,9 +101,19 @@ CREATE TABLE IF NOT EXISTS assets (
     duration_seconds INTEGER, -- For videos
     width INTEGER, -- For images/videos
     height INTEGER, -- For images/videos
+    blur_hash TEXT, -- For images, computed at upload
+    dominant_color TEXT, -- For images, hex color code
+    accent_color TEXT, -- For images, hex color code
     created_at TIMESTAMP WITH TIME ZONE DEFAULT NOW()
 );
 
+-- Image placeholder columns for databases created before they were added
+ALTER TABLE projects ADD COLUMN IF NOT EXISTS game_logo_placeholder TEXT;
+ALTER TABLE projects ADD COLUMN IF NOT EXISTS cover_art_placeholder TEXT;
+ALTER TABLE assets ADD COLUMN IF NOT EXISTS blur_hash TEXT;
+ALTER TABLE assets ADD COLUMN IF NOT EXISTS dominant_color TEXT;
+ALTER TABLE assets ADD COLUMN IF NOT EXISTS accent_color TEXT;
+
 -- Organizations table
 CREATE TABLE IF NOT EXISTS organizations (
     id UUID DEFAULT gen_random_uuid() PRIMARY KEY,